@@ -1,7 +1,33 @@
 #include "Dice.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/TextRenderComponent.h"
-#include "DrawDebugHelpers.h"
+#include "DiceDebugOverlay.h"
+#include "DiceGameManager.h"
+#include "DiceSignificance.h"
+#include "DiceLabelBatcher.h"
+#include "SoundManager.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarDiceImpactMinSpeed(
+	TEXT("dice.Audio.ImpactMinSpeed"),
+	40.0f,
+	TEXT("Velocity change (cm/s, impulse / mass) under which a die's hit makes no sound - rolling and resting contacts stay quiet."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceImpactFullSpeed(
+	TEXT("dice.Audio.ImpactFullSpeed"),
+	500.0f,
+	TEXT("Velocity change (cm/s) of a hit that plays at full volume and pitch."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceImpactInterval(
+	TEXT("dice.Audio.ImpactInterval"),
+	0.08f,
+	TEXT("Minimum seconds between impact sounds from one die. Hits inside the window are dropped."),
+	ECVF_Default);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dice Hits"), STAT_DiceHits, STATGROUP_DiceGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dice Hits Sounded"), STAT_DiceHitsSounded, STATGROUP_DiceGame);
 
 ADice::ADice()
 {
@@ -17,7 +43,7 @@ ADice::ADice()
 	}
 
 	DiceSize = 0.15f;
-	bShowDebugNumbers = true;
+	bShowDebugNumbers = false;
 
 	Mesh->SetWorldScale3D(FVector(DiceSize));
 	Mesh->SetSimulatePhysics(true);
@@ -32,13 +58,14 @@ ADice::ADice()
 	Mesh->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
 
 	bHasBeenThrown = false;
-	bHasPlayedLandSound = false;
+	bHasReportedSettle = false;
 	bIsHighlighted = false;
 	bIsMatched = false;
 	bIsBeingDragged = false;
 	bHasGlow = false;
 	CurrentValue = 0;
 	HighlightPulse = 0.0f;
+	LastImpactTime = -1.0f;
 	TextColor = FColor::White;
 	MeshNormalizeScale = 1.0f;
 	bHighlightRotSet = false;
@@ -55,16 +82,47 @@ ADice::ADice()
 void ADice::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Face numbers draw through the shared label mesh
+	for (UTextRenderComponent* TextComp : FaceTexts)
+	{
+		UDiceLabelBatcher::Adopt(TextComp);
+	}
+
+	// Landing sounds come from the hits themselves
+	Mesh->OnComponentHit.AddDynamic(this, &ADice::OnMeshHit);
+
+	// Tick only animates the hover sway - a resting die can idle at a low rate
+	if (UDiceSignificanceManager* Significance = UDiceSignificanceManager::Get(this))
+	{
+		Significance->Register(this, PrimaryActorTick, Mesh, [this](EGamePhase Phase)
+		{
+			if (bIsHighlighted || bHighlightRotSet)
+			{
+				return EDiceSignificance::High;
+			}
+#if DICE_DEBUG_DRAW
+			// Debug numbers are drawn for a single frame
+			if (bShowDebugNumbers || UDiceDebugOverlay::IsDebugDrawEnabled())
+			{
+				return EDiceSignificance::Critical;
+			}
+#endif
+			return Phase == EGamePhase::PlayerMatching ? EDiceSignificance::Medium : EDiceSignificance::Low;
+		});
+	}
 }
 
 void ADice::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (bShowDebugNumbers)
+#if DICE_DEBUG_DRAW
+	if (bShowDebugNumbers || UDiceDebugOverlay::IsDebugDrawEnabled())
 	{
 		DrawFaceNumbers();
 	}
+#endif
 
 	float BaseScale = DiceSize * MeshNormalizeScale;
 	Mesh->SetWorldScale3D(FVector(BaseScale));
@@ -139,7 +197,7 @@ void ADice::Tick(float DeltaTime)
 void ADice::Throw(FVector Direction, float Force)
 {
 	bHasBeenThrown = true;
-	bHasPlayedLandSound = false;  // Reset so landing sound plays again
+	bHasReportedSettle = false;  // Reset so the settled event goes out again
 
 	Direction.Normalize();
 	Mesh->AddImpulse(Direction * Force, NAME_None, true);
@@ -153,6 +211,46 @@ void ADice::Throw(FVector Direction, float Force)
 	Mesh->AddAngularImpulseInDegrees(RandomTorque, NAME_None, true);
 }
 
+void ADice::OnMeshHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+	// Spawning onto the table and being carried around make no sound
+	if (!bHasBeenThrown || bIsBeingDragged)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_DiceHits);
+
+	// Impulse over mass so custom meshes of any size sound the same for the same throw
+	const float Mass = Mesh->GetMass();
+	const float Speed = Mass > KINDA_SMALL_NUMBER ? NormalImpulse.Size() / Mass : 0.0f;
+	const float MinSpeed = CVarDiceImpactMinSpeed.GetValueOnGameThread();
+	if (Speed < MinSpeed)
+	{
+		return;
+	}
+
+	// A tumbling die reports a hit on every contact frame - one sound per bounce
+	const float Now = GetWorld()->GetTimeSeconds();
+	if (LastImpactTime >= 0.0f && Now - LastImpactTime < CVarDiceImpactInterval.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	ASoundManager* Sound = ASoundManager::GetInstance(GetWorld());
+	if (!Sound)
+	{
+		return;
+	}
+
+	LastImpactTime = Now;
+	INC_DWORD_STAT(STAT_DiceHitsSounded);
+
+	const float FullSpeed = FMath::Max(MinSpeed + 1.0f, CVarDiceImpactFullSpeed.GetValueOnGameThread());
+	const float Strength = FMath::Clamp((Speed - MinSpeed) / (FullSpeed - MinSpeed), 0.0f, 1.0f);
+	Sound->QueueDiceImpact(this, Hit.ImpactPoint, Strength);
+}
+
 bool ADice::IsStill()
 {
 	if (!bHasBeenThrown)
@@ -164,6 +262,11 @@ bool ADice::IsStill()
 	return Velocity.Size() < 1.0f && AngularVelocity.Size() < 1.0f;
 }
 
+bool ADice::IsAsleep() const
+{
+	return bHasBeenThrown && Mesh && Mesh->IsSimulatingPhysics() && !Mesh->IsAnyRigidBodyAwake();
+}
+
 int32 ADice::GetResult()
 {
 	float HighestDot = -2.0f;
@@ -184,8 +287,12 @@ int32 ADice::GetResult()
 	return TopFace;
 }
 
+#if DICE_DEBUG_DRAW
 void ADice::DrawFaceNumbers()
 {
+	UDiceDebugOverlay* Overlay = UDiceDebugOverlay::Get(GetWorld());
+	if (!Overlay) return;
+
 	float CubeExtent = 50.0f * DiceSize;
 	int32 TopFace = GetResult();
 
@@ -207,13 +314,14 @@ void ADice::DrawFaceNumbers()
 		FColor Color = (i == TopFace) ? DiceColor : FColor(100, 100, 100);
 		FString Num = FString::FromInt(i);
 
-		DrawDebugString(GetWorld(), WorldCenter, Num, nullptr, Color, 0.0f, true, 2.0f);
+		Overlay->AddWorldText(WorldCenter, Num, Color, 2.0f);
 	}
 
 	FVector TopIndicator = GetActorLocation() + FVector(0, 0, CubeExtent + 15.0f);
 	int32 DisplayValue = (CurrentValue > 0) ? CurrentValue : TopFace;
-	DrawDebugString(GetWorld(), TopIndicator, FString::Printf(TEXT("[%d]"), DisplayValue), nullptr, DiceColor, 0.0f, true, 3.5f);
+	Overlay->AddWorldText(TopIndicator, FString::Printf(TEXT("[%d]"), DisplayValue), DiceColor, 3.5f);
 }
+#endif
 
 FVector ADice::GetFaceNormal(int32 FaceIndex)
 {
@@ -285,11 +393,17 @@ void ADice::SetHighlighted(bool bHighlight)
 		bHighlightRotSet = false;
 	}
 
+	const bool bChanged = (bIsHighlighted != bHighlight);
 	bIsHighlighted = bHighlight;
 	if (!bHighlight)
 	{
 		HighlightPulse = 0.0f;
 	}
+
+	if (bChanged)
+	{
+		UDiceSignificanceManager::RefreshFor(this);
+	}
 }
 
 void ADice::SetMatched(bool bMatch)
@@ -327,6 +441,8 @@ void ADice::SetCustomMesh(UStaticMesh* NewMesh, float MeshScale)
 	{
 		Mesh->SetStaticMesh(NewMesh);
 		MeshNormalizeScale = MeshScale;
+		// Apply now - Tick may be idling at a low rate
+		Mesh->SetWorldScale3D(FVector(DiceSize * MeshNormalizeScale));
 	}
 }
 
@@ -345,7 +461,7 @@ void ADice::SetTextColor(FColor NewColor)
 	{
 		if (TextComp)
 		{
-			TextComp->SetTextRenderColor(NewColor);
+			UDiceLabelBatcher::SetColor(TextComp, NewColor);
 		}
 	}
 }
@@ -378,8 +494,8 @@ void ADice::SetAllFacesText(const FString& Text)
 		UTextRenderComponent* TextComp = FaceTexts[i];
 		if (TextComp)
 		{
-			TextComp->SetText(FText::FromString(Text));
-			TextComp->SetWorldSize(FaceTextSize * 1.2f);  // Larger for number display
+			UDiceLabelBatcher::SetText(TextComp, FText::FromString(Text));
+			UDiceLabelBatcher::SetWorldSize(TextComp, FaceTextSize * 1.2f);  // Larger for number display
 			// Push text further out so it's visible
 			FVector LocalPos = GetFaceNormal(i + 1) * (FaceTextOffset + 5.0f);
 			TextComp->SetRelativeLocation(LocalPos);
@@ -404,7 +520,7 @@ void ADice::SetTextSettings(float Size, float Offset)
 			TextComp->SetRelativeLocation(LocalPos);
 
 			// Update size
-			TextComp->SetWorldSize(FaceTextSize);
+			UDiceLabelBatcher::SetWorldSize(TextComp, FaceTextSize);
 		}
 	}
 }
@@ -2,10 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "GGJ26.h"
 #include "Dice.generated.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
+class UPrimitiveComponent;
 
 UCLASS()
 class ADice : public AActor
@@ -27,7 +29,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	float DiceSize;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug", meta = (ToolTip = "Draw face numbers via the debug overlay (non-shipping builds only)"))
 	bool bShowDebugNumbers;
 
 	UFUNCTION(BlueprintCallable)
@@ -36,6 +38,9 @@ public:
 	UFUNCTION(BlueprintCallable)
 	bool IsStill();
 
+	// True once physics has put the die to sleep after a throw
+	bool IsAsleep() const;
+
 	UFUNCTION(BlueprintCallable)
 	int32 GetResult();
 
@@ -96,8 +101,8 @@ public:
 	// Allow external reset for re-throwing
 	bool bHasBeenThrown;
 
-	// Sound tracking - reset when thrown, set when landed
-	bool bHasPlayedLandSound;
+	// Settle tracking - reset when thrown, set once the settled event has gone out
+	bool bHasReportedSettle;
 
 	// Highlight sway
 	FRotator BaseHighlightRot;
@@ -110,8 +115,16 @@ public:
 private:
 	float HighlightPulse;
 
+	// Impact audio - time of the last impact sent to the sound manager
+	float LastImpactTime;
+
+	UFUNCTION()
+	void OnMeshHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
+
 	void SetupFaceTexts();
+#if DICE_DEBUG_DRAW
 	void DrawFaceNumbers();
+#endif
 	int32 GetFaceValueFromDirection(FVector LocalDirection);
 	FVector GetFaceCenter(int32 FaceIndex);
 	FVector GetFaceNormal(int32 FaceIndex);
@@ -0,0 +1,267 @@
+#include "DiceBallistics.h"
+#include "GGJ26.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ballistics Step"), STAT_DiceBallisticsStep, STATGROUP_DiceGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Ballistic Bodies"), STAT_DiceBallisticBodies, STATGROUP_DiceGame);
+
+// No floor: far enough below anything in the level that the bounce test never passes
+static constexpr float NoFloorZ = -1.0e9f;
+
+// Alpha callbacks fire at most this many times over a lifetime
+static constexpr float AlphaSteps = 255.0f;
+
+FDiceBallisticHandle FDiceBallistics::Add(AActor* Actor, FDiceBallisticParams&& Params)
+{
+	FDiceBallisticHandle Handle;
+	if (!Actor)
+	{
+		return Handle;
+	}
+
+	const FVector Location = Actor->GetActorLocation();
+	const FRotator Rotation = Actor->GetActorRotation();
+
+	PosX.Add(float(Location.X)); PosY.Add(float(Location.Y)); PosZ.Add(float(Location.Z));
+	VelX.Add(float(Params.Velocity.X)); VelY.Add(float(Params.Velocity.Y)); VelZ.Add(float(Params.Velocity.Z));
+	Pitch.Add(float(Rotation.Pitch)); Yaw.Add(float(Rotation.Yaw)); Roll.Add(float(Rotation.Roll));
+	SpinPitch.Add(float(Params.Spin.Pitch)); SpinYaw.Add(float(Params.Spin.Yaw)); SpinRoll.Add(float(Params.Spin.Roll));
+	Gravity.Add(Params.Gravity);
+	Drag.Add(Params.Drag);
+	SpinDamping.Add(Params.SpinDamping);
+	FloorZ.Add(Params.bFloor ? Params.FloorZ : NoFloorZ);
+	Restitution.Add(Params.Restitution);
+	Friction.Add(Params.Friction);
+	BounceSpinScale.Add(Params.BounceSpinScale);
+	Age.Add(0.0f);
+	InvLifetime.Add(Params.Lifetime > 0.0f ? 1.0f / Params.Lifetime : 0.0f);
+	Bounces.Add(0);
+	BounceSpeed.Add(0.0f);
+
+	Actors.Add(Actor);
+	ScaleTargets.Add(Params.ScaleTarget);
+	BaseScales.Add(Params.ScaleTarget ? Params.ScaleTarget->GetComponentScale() : FVector::OneVector);
+	ScaleStart.Add(Params.ScaleStart);
+	ScaleEnd.Add(Params.ScaleEnd);
+	AlphaStart.Add(Params.AlphaStart);
+	AlphaEnd.Add(Params.AlphaEnd);
+	AlphaCallbacks.Add(MoveTemp(Params.OnAlpha));
+	LastAlphaStep.Add(INDEX_NONE);
+
+	int32 SlotIndex;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = Slots.AddDefaulted();
+	}
+	Slots[SlotIndex].Dense = Actors.Num() - 1;
+	DenseToSlot.Add(SlotIndex);
+
+	Handle.Index = SlotIndex;
+	Handle.Serial = Slots[SlotIndex].Serial;
+	return Handle;
+}
+
+void FDiceBallistics::Remove(FDiceBallisticHandle& Handle)
+{
+	const int32 Dense = Resolve(Handle);
+	if (Dense != INDEX_NONE)
+	{
+		RemoveDense(Dense);
+	}
+	Handle.Invalidate();
+}
+
+void FDiceBallistics::Reset()
+{
+	while (Actors.Num() > 0)
+	{
+		RemoveDense(Actors.Num() - 1);
+	}
+}
+
+int32 FDiceBallistics::Resolve(const FDiceBallisticHandle& Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.Index) || Slots[Handle.Index].Serial != Handle.Serial)
+	{
+		return INDEX_NONE;
+	}
+	return Slots[Handle.Index].Dense;
+}
+
+void FDiceBallistics::RemoveDense(int32 Dense)
+{
+	// Swap the last body into the hole so every array stays packed
+	const int32 Last = Actors.Num() - 1;
+
+	FSlot& Slot = Slots[DenseToSlot[Dense]];
+	Slot.Dense = INDEX_NONE;
+	Slot.Serial++;
+	FreeSlots.Push(DenseToSlot[Dense]);
+
+	if (Dense != Last)
+	{
+		Slots[DenseToSlot[Last]].Dense = Dense;
+	}
+
+	PosX.RemoveAtSwap(Dense, 1, EAllowShrinking::No); PosY.RemoveAtSwap(Dense, 1, EAllowShrinking::No); PosZ.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	VelX.RemoveAtSwap(Dense, 1, EAllowShrinking::No); VelY.RemoveAtSwap(Dense, 1, EAllowShrinking::No); VelZ.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Pitch.RemoveAtSwap(Dense, 1, EAllowShrinking::No); Yaw.RemoveAtSwap(Dense, 1, EAllowShrinking::No); Roll.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	SpinPitch.RemoveAtSwap(Dense, 1, EAllowShrinking::No); SpinYaw.RemoveAtSwap(Dense, 1, EAllowShrinking::No); SpinRoll.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Gravity.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Drag.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	SpinDamping.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	FloorZ.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Restitution.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Friction.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	BounceSpinScale.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Age.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	InvLifetime.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	Bounces.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	BounceSpeed.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+
+	Actors.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	ScaleTargets.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	BaseScales.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	ScaleStart.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	ScaleEnd.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	AlphaStart.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	AlphaEnd.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	AlphaCallbacks.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	LastAlphaStep.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+	DenseToSlot.RemoveAtSwap(Dense, 1, EAllowShrinking::No);
+}
+
+// ==================== STEP ====================
+
+void FDiceBallistics::Step(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DiceBallisticsStep);
+	INC_DWORD_STAT_BY(STAT_DiceBallisticBodies, Actors.Num());
+
+	// Bodies whose actor is gone stop here, before anything reads them
+	for (int32 i = Actors.Num() - 1; i >= 0; i--)
+	{
+		if (!Actors[i].IsValid())
+		{
+			RemoveDense(i);
+		}
+	}
+
+	const int32 Count = Actors.Num();
+	if (Count == 0 || DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	// Integrate - straight-line float math over packed arrays, selects instead of branches so it vectorizes
+	float* RESTRICT PX = PosX.GetData(); float* RESTRICT PY = PosY.GetData(); float* RESTRICT PZ = PosZ.GetData();
+	float* RESTRICT VX = VelX.GetData(); float* RESTRICT VY = VelY.GetData(); float* RESTRICT VZ = VelZ.GetData();
+	float* RESTRICT RP = Pitch.GetData(); float* RESTRICT RY = Yaw.GetData(); float* RESTRICT RR = Roll.GetData();
+	float* RESTRICT SP = SpinPitch.GetData(); float* RESTRICT SY = SpinYaw.GetData(); float* RESTRICT SR = SpinRoll.GetData();
+	const float* RESTRICT G = Gravity.GetData();
+	const float* RESTRICT D = Drag.GetData();
+	const float* RESTRICT SD = SpinDamping.GetData();
+	const float* RESTRICT FZ = FloorZ.GetData();
+	const float* RESTRICT RE = Restitution.GetData();
+	const float* RESTRICT FR = Friction.GetData();
+	const float* RESTRICT BS = BounceSpinScale.GetData();
+	float* RESTRICT A = Age.GetData();
+	int32* RESTRICT B = Bounces.GetData();
+	float* RESTRICT BV = BounceSpeed.GetData();
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		const float Damp = FMath::Max(0.0f, 1.0f - D[i] * DeltaTime);
+		const float SpinDamp = FMath::Max(0.0f, 1.0f - SD[i] * DeltaTime);
+
+		const float NewVX = VX[i] * Damp;
+		const float NewVY = VY[i] * Damp;
+		const float NewVZ = (VZ[i] - G[i] * DeltaTime) * Damp;
+		const float NewPZ = PZ[i] + NewVZ * DeltaTime;
+		PX[i] += NewVX * DeltaTime;
+		PY[i] += NewVY * DeltaTime;
+
+		// Floor plane: clamp, reflect and bleed off speed and spin
+		const bool bBounce = NewPZ < FZ[i];
+		const float Keep = bBounce ? FR[i] : 1.0f;
+		const float SpinKeep = bBounce ? SpinDamp * BS[i] : SpinDamp;
+		const float OutVZ = bBounce ? -NewVZ * RE[i] : NewVZ;
+		PZ[i] = bBounce ? FZ[i] : NewPZ;
+		VX[i] = NewVX * Keep;
+		VY[i] = NewVY * Keep;
+		VZ[i] = OutVZ;
+		B[i] += bBounce ? 1 : 0;
+		BV[i] = bBounce ? FMath::Abs(OutVZ) : BV[i];
+
+		RP[i] += SP[i] * DeltaTime;
+		RY[i] += SY[i] * DeltaTime;
+		RR[i] += SR[i] * DeltaTime;
+		SP[i] *= SpinKeep;
+		SY[i] *= SpinKeep;
+		SR[i] *= SpinKeep;
+
+		A[i] += DeltaTime;
+	}
+
+	// Commit - one transform write per actor, scale/alpha only for bodies that animate them
+	for (int32 i = 0; i < Count; i++)
+	{
+		AActor* Actor = Actors[i].Get();
+		if (!Actor)
+		{
+			continue;  // Destroyed by an overlap from an earlier commit - pruned next step
+		}
+		Actor->SetActorLocationAndRotation(FVector(PX[i], PY[i], PZ[i]), FRotator(RP[i], RY[i], RR[i]));
+
+		const float Life = FMath::Min(A[i] * InvLifetime[i], 1.0f);
+
+		if (ScaleStart[i] != ScaleEnd[i])
+		{
+			if (USceneComponent* Target = ScaleTargets[i].Get())
+			{
+				Target->SetWorldScale3D(BaseScales[i] * FMath::Lerp(ScaleStart[i], ScaleEnd[i], Life));
+			}
+		}
+
+		if (AlphaCallbacks[i] && AlphaStart[i] != AlphaEnd[i])
+		{
+			const float Alpha = FMath::Lerp(AlphaStart[i], AlphaEnd[i], Life);
+			const int32 AlphaStep = FMath::RoundToInt(Alpha * AlphaSteps);
+			if (AlphaStep != LastAlphaStep[i])
+			{
+				LastAlphaStep[i] = AlphaStep;
+				AlphaCallbacks[i](Alpha);
+			}
+		}
+	}
+}
+
+// ==================== QUERIES ====================
+
+bool FDiceBallistics::IsActive(const FDiceBallisticHandle& Handle) const
+{
+	return Resolve(Handle) != INDEX_NONE;
+}
+
+FVector FDiceBallistics::GetVelocity(const FDiceBallisticHandle& Handle) const
+{
+	const int32 Dense = Resolve(Handle);
+	return Dense != INDEX_NONE ? FVector(VelX[Dense], VelY[Dense], VelZ[Dense]) : FVector::ZeroVector;
+}
+
+int32 FDiceBallistics::GetBounceCount(const FDiceBallisticHandle& Handle) const
+{
+	const int32 Dense = Resolve(Handle);
+	return Dense != INDEX_NONE ? Bounces[Dense] : 0;
+}
+
+float FDiceBallistics::GetLastBounceSpeed(const FDiceBallisticHandle& Handle) const
+{
+	const int32 Dense = Resolve(Handle);
+	return Dense != INDEX_NONE ? BounceSpeed[Dense] : 0.0f;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+class USceneComponent;
+
+// Handle to a body in FDiceBallistics. Stale handles are safe to query/remove.
+struct FDiceBallisticHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+};
+
+// Launch parameters for one scripted body
+struct FDiceBallisticParams
+{
+	FVector Velocity = FVector::ZeroVector;
+	FRotator Spin = FRotator::ZeroRotator;  // Degrees per second per axis
+
+	float Gravity = 800.0f;
+	float Drag = 0.0f;          // Fraction of velocity lost per second
+	float SpinDamping = 0.0f;   // Fraction of spin lost per second
+
+	// Floor plane bounce
+	bool bFloor = false;
+	float FloorZ = 0.0f;
+	float Restitution = 0.6f;      // Vertical speed kept per bounce
+	float Friction = 0.98f;        // Horizontal speed kept per bounce
+	float BounceSpinScale = 0.7f;  // Spin kept per bounce
+
+	// Over lifetime (Lifetime 0 = no lifetime curve)
+	float Lifetime = 0.0f;
+	float ScaleStart = 1.0f;
+	float ScaleEnd = 1.0f;
+	float AlphaStart = 1.0f;
+	float AlphaEnd = 1.0f;
+
+	USceneComponent* ScaleTarget = nullptr;  // World scale multiplied by the lifetime scale
+	TFunction<void(float)> OnAlpha;          // Called when the lifetime alpha moves by a visible step (must not add/remove bodies)
+};
+
+// Kinematic integrator for scripted arcs (dice dispersing, flying off, bouncing to a stop).
+// Bodies are kept structure-of-arrays: one tight loop integrates gravity, drag, floor bounces, spin and
+// lifetime for every body, then a second pass commits each actor's transform once.
+class FDiceBallistics
+{
+public:
+	// Start integrating Actor from its current transform
+	FDiceBallisticHandle Add(AActor* Actor, FDiceBallisticParams&& Params);
+
+	// Stop integrating - the actor keeps whatever transform it was last given
+	void Remove(FDiceBallisticHandle& Handle);
+	void Reset();
+
+	void Step(float DeltaTime);
+
+	bool IsActive(const FDiceBallisticHandle& Handle) const;
+	FVector GetVelocity(const FDiceBallisticHandle& Handle) const;
+	int32 GetBounceCount(const FDiceBallisticHandle& Handle) const;
+	float GetLastBounceSpeed(const FDiceBallisticHandle& Handle) const;  // Vertical speed leaving the last bounce
+
+	int32 Num() const { return Actors.Num(); }
+
+private:
+	// Hot - touched by the integration loop
+	TArray<float> PosX, PosY, PosZ;
+	TArray<float> VelX, VelY, VelZ;
+	TArray<float> Pitch, Yaw, Roll;
+	TArray<float> SpinPitch, SpinYaw, SpinRoll;
+	TArray<float> Gravity, Drag, SpinDamping;
+	TArray<float> FloorZ, Restitution, Friction, BounceSpinScale;
+	TArray<float> Age, InvLifetime;
+	TArray<int32> Bounces;
+	TArray<float> BounceSpeed;
+
+	// Cold - only touched when committing
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<TWeakObjectPtr<USceneComponent>> ScaleTargets;
+	TArray<FVector> BaseScales;
+	TArray<float> ScaleStart, ScaleEnd, AlphaStart, AlphaEnd;
+	TArray<TFunction<void(float)>> AlphaCallbacks;
+	TArray<int32> LastAlphaStep;
+	TArray<int32> DenseToSlot;
+
+	// Handle slots -> dense index
+	struct FSlot
+	{
+		int32 Dense = INDEX_NONE;
+		uint32 Serial = 1;
+	};
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+
+	int32 Resolve(const FDiceBallisticHandle& Handle) const;
+	void RemoveDense(int32 Dense);
+};
@@ -6,6 +6,9 @@
 ADiceCamera::ADiceCamera()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	// Compose after gameplay and physics have set this frame's layers, but before the player camera manager
+	// reads the view (it updates between PostPhysics and PostUpdateWork) so no layer lands a frame late
+	PrimaryActorTick.TickGroup = TG_PostPhysics;
 
 	Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
 	RootComponent = Root;
@@ -20,14 +23,16 @@ ADiceCamera::ADiceCamera()
 	bIsMainCamera = true;
 
 	TimeAccumulator = 0.0f;
+	BaseLocation = FVector::ZeroVector;
+	BaseRotation = FRotator::ZeroRotator;
 }
 
 void ADiceCamera::BeginPlay()
 {
 	Super::BeginPlay();
 
-	InitialPosition = Camera->GetRelativeLocation();
-	InitialRotation = Camera->GetRelativeRotation();
+	BaseLocation = GetActorLocation();
+	BaseRotation = GetActorRotation();
 
 	if (bIsMainCamera)
 	{
@@ -43,23 +48,34 @@ void ADiceCamera::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	if (!bEnableBreathing)
-		return;
+	FVector NewLocation;
+	FRotator NewRotation;
+	ComposePose((int32)ECameraLayer::Count, NewLocation, NewRotation);
 
-	TimeAccumulator += DeltaTime;
+	for (const FOffsetLayer& Offset : OffsetLayers)
+	{
+		if (Offset.bActive)
+		{
+			NewLocation += Offset.Location;
+			NewRotation += Offset.Rotation;
+		}
+	}
 
-	float BreathValue = FMath::Sin(TimeAccumulator * BreathingSpeed);
-	float BreathValueSecondary = FMath::Sin(TimeAccumulator * BreathingSpeed * 0.7f);
+	if (bEnableBreathing)
+	{
+		TimeAccumulator += DeltaTime;
 
-	FVector NewPosition = InitialPosition;
-	NewPosition.Z += BreathValue * BreathingAmplitudeZ;
+		float BreathValue = FMath::Sin(TimeAccumulator * BreathingSpeed);
+		float BreathValueSecondary = FMath::Sin(TimeAccumulator * BreathingSpeed * 0.7f);
 
-	FRotator NewRotation = InitialRotation;
-	NewRotation.Pitch += BreathValue * BreathingAmplitudeRotation;
-	NewRotation.Roll += BreathValueSecondary * BreathingAmplitudeRotation * 0.5f;
+		// Bob along the camera's own up axis, like the old relative offset
+		NewLocation += NewRotation.RotateVector(FVector(0.0f, 0.0f, BreathValue * BreathingAmplitudeZ));
+		NewRotation.Pitch += BreathValue * BreathingAmplitudeRotation;
+		NewRotation.Roll += BreathValueSecondary * BreathingAmplitudeRotation * 0.5f;
+	}
 
-	Camera->SetRelativeLocation(NewPosition);
-	Camera->SetRelativeRotation(NewRotation);
+	// The one transform write per frame
+	SetActorLocationAndRotation(NewLocation, NewRotation);
 }
 
 void ADiceCamera::ActivateCamera()
@@ -70,3 +86,88 @@ void ADiceCamera::ActivateCamera()
 		PC->SetViewTargetWithBlend(this, 0.5f);
 	}
 }
+
+ADiceCamera* ADiceCamera::Get(const UObject* WorldContext)
+{
+	AGameModeDice* GM = Cast<AGameModeDice>(UGameplayStatics::GetGameMode(WorldContext));
+	if (GM && IsValid(GM->MainCamera))
+	{
+		return GM->MainCamera;
+	}
+
+	// No game mode registration (e.g. different game mode) - fall back to a search
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	if (!World) return nullptr;
+
+	TArray<AActor*> FoundCameras;
+	UGameplayStatics::GetAllActorsOfClass(World, ADiceCamera::StaticClass(), FoundCameras);
+	for (AActor* A : FoundCameras)
+	{
+		ADiceCamera* Cam = Cast<ADiceCamera>(A);
+		if (Cam && Cam->bIsMainCamera)
+		{
+			return Cam;
+		}
+	}
+	return FoundCameras.Num() > 0 ? Cast<ADiceCamera>(FoundCameras[0]) : nullptr;
+}
+
+// ==================== RIG ====================
+
+void ADiceCamera::SetPoseLayer(ECameraLayer Layer, const FVector& Location, const FRotator& Rotation, float Weight)
+{
+	FPoseLayer& L = PoseLayers[(int32)Layer];
+	L.Location = Location;
+	L.Rotation = Rotation;
+	L.Weight = FMath::Clamp(Weight, 0.0f, 1.0f);
+	L.bActive = true;
+}
+
+void ADiceCamera::ClearPoseLayer(ECameraLayer Layer)
+{
+	PoseLayers[(int32)Layer] = FPoseLayer();
+}
+
+bool ADiceCamera::IsPoseLayerActive(ECameraLayer Layer) const
+{
+	return PoseLayers[(int32)Layer].bActive;
+}
+
+void ADiceCamera::SetOffsetLayer(ECameraOffset Layer, const FVector& Location, const FRotator& Rotation)
+{
+	FOffsetLayer& L = OffsetLayers[(int32)Layer];
+	L.Location = Location;
+	L.Rotation = Rotation;
+	L.bActive = true;
+}
+
+void ADiceCamera::ClearOffsetLayer(ECameraOffset Layer)
+{
+	OffsetLayers[(int32)Layer] = FOffsetLayer();
+}
+
+void ADiceCamera::GetPoseBelow(ECameraLayer Layer, FVector& OutLocation, FRotator& OutRotation) const
+{
+	ComposePose((int32)Layer, OutLocation, OutRotation);
+}
+
+void ADiceCamera::GetViewPose(FVector& OutLocation, FRotator& OutRotation) const
+{
+	ComposePose((int32)ECameraLayer::Count, OutLocation, OutRotation);
+}
+
+void ADiceCamera::ComposePose(int32 NumLayers, FVector& OutLocation, FRotator& OutRotation) const
+{
+	OutLocation = BaseLocation;
+	OutRotation = BaseRotation;
+
+	for (int32 i = 0; i < NumLayers; i++)
+	{
+		const FPoseLayer& L = PoseLayers[i];
+		if (L.bActive)
+		{
+			OutLocation = FMath::Lerp(OutLocation, L.Location, L.Weight);
+			OutRotation = FMath::Lerp(OutRotation, L.Rotation, L.Weight);
+		}
+	}
+}
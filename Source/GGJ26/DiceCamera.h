@@ -6,6 +6,27 @@
 
 class UCameraComponent;
 
+// Pose layers - each one blends from the pose below it toward its own pose by its weight, in this order
+enum class ECameraLayer : uint8
+{
+	Pan,          // Game manager lineup pan
+	BonusFocus,   // Bonus round button focus
+	ButtonFocus,  // IR button's own focus
+	HandZoom,     // Chop zoom toward the enemy hand
+	Sequence,     // Win/lose sequence
+	DebugLock,    // dice.Debug.BonusCamera
+	Count
+};
+
+// Offset layers - added on top of the composed pose
+enum class ECameraOffset : uint8
+{
+	HandShake,
+	BonusShake,
+	SequenceBreath,
+	Count
+};
+
 UCLASS()
 class ADiceCamera : public AActor
 {
@@ -41,8 +62,49 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void ActivateCamera();
 
+	// Main camera for this world (the one registered with the game mode, else the first one found)
+	static ADiceCamera* Get(const UObject* WorldContext);
+
+	// ===== RIG =====
+	// Nothing moves the actor directly - systems set layers and the camera composes them once per frame (TG_PostPhysics, before the view is built)
+	void SetPoseLayer(ECameraLayer Layer, const FVector& Location, const FRotator& Rotation, float Weight = 1.0f);
+	void ClearPoseLayer(ECameraLayer Layer);
+	bool IsPoseLayerActive(ECameraLayer Layer) const;
+
+	void SetOffsetLayer(ECameraOffset Layer, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+	void ClearOffsetLayer(ECameraOffset Layer);
+
+	// Pose from the base and every layer below Layer - where a layer blending in starts from
+	void GetPoseBelow(ECameraLayer Layer, FVector& OutLocation, FRotator& OutRotation) const;
+
+	// Full pose without offsets or breathing
+	void GetViewPose(FVector& OutLocation, FRotator& OutRotation) const;
+
+	const FVector& GetBaseLocation() const { return BaseLocation; }
+	const FRotator& GetBaseRotation() const { return BaseRotation; }
+
 private:
 	float TimeAccumulator;
-	FVector InitialPosition;
-	FRotator InitialRotation;
+
+	struct FPoseLayer
+	{
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		float Weight = 0.0f;
+		bool bActive = false;
+	};
+	struct FOffsetLayer
+	{
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+		bool bActive = false;
+	};
+	FPoseLayer PoseLayers[(int32)ECameraLayer::Count];
+	FOffsetLayer OffsetLayers[(int32)ECameraOffset::Count];
+
+	// Placed pose - everything composes on top of this
+	FVector BaseLocation;
+	FRotator BaseRotation;
+
+	void ComposePose(int32 NumLayers, FVector& OutLocation, FRotator& OutRotation) const;
 };
@@ -0,0 +1,177 @@
+#include "DiceDebris.h"
+#include "GGJ26.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarDiceDebrisMax(
+	TEXT("dice.Debris.Max"),
+	8,
+	TEXT("Most debris bodies (fingers, knives, masks) kept in the world. Past this the oldest is hidden and its collision removed."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceDebrisRestSpeed(
+	TEXT("dice.Debris.RestSpeed"),
+	5.0f,
+	TEXT("Linear speed (cm/s) under which a debris body counts as resting. Angular speed uses the same number in deg/s x 4."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceDebrisRestTime(
+	TEXT("dice.Debris.RestTime"),
+	0.5f,
+	TEXT("Seconds a debris body has to rest (or be asleep) before it is frozen in place."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceDebrisMaxAwakeTime(
+	TEXT("dice.Debris.MaxAwakeTime"),
+	8.0f,
+	TEXT("Debris still jittering after this many seconds is frozen anyway."),
+	ECVF_Default);
+
+DECLARE_CYCLE_STAT(TEXT("Debris Tick"), STAT_DiceDebrisTick, STATGROUP_DiceGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Debris Tracked"), STAT_DiceDebrisTracked, STATGROUP_DiceGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Debris Awake"), STAT_DiceDebrisAwake, STATGROUP_DiceGame);
+
+UDiceDebrisManager::UDiceDebrisManager()
+{
+	NumAwake = 0;
+}
+
+void UDiceDebrisManager::Deinitialize()
+{
+	Debris.Empty();
+	NumAwake = 0;
+	Super::Deinitialize();
+}
+
+TStatId UDiceDebrisManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDiceDebrisManager, STATGROUP_Tickables);
+}
+
+UDiceDebrisManager* UDiceDebrisManager::Get(const UObject* WorldContext)
+{
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDiceDebrisManager>() : nullptr;
+}
+
+// ==================== TRACKING ====================
+
+void UDiceDebrisManager::Track(UPrimitiveComponent* Body)
+{
+	if (!Body) return;
+
+	Untrack(Body);
+
+	FDebris& Entry = Debris.AddDefaulted_GetRef();
+	Entry.Body = Body;
+	Entry.bFrozen = !Body->IsSimulatingPhysics();
+	if (!Entry.bFrozen)
+	{
+		NumAwake++;
+	}
+
+	// Over the cap - retire the oldest first
+	const int32 MaxDebris = FMath::Max(1, CVarDiceDebrisMax.GetValueOnGameThread());
+	while (Debris.Num() > MaxDebris)
+	{
+		UPrimitiveComponent* Oldest = Debris[0].Body.Get();
+		RemoveEntry(0);
+		Retire(Oldest);
+	}
+}
+
+void UDiceDebrisManager::Untrack(UPrimitiveComponent* Body)
+{
+	const int32 Index = Debris.IndexOfByPredicate([Body](const FDebris& Entry) { return Entry.Body.Get() == Body; });
+	if (Index != INDEX_NONE)
+	{
+		RemoveEntry(Index);
+	}
+}
+
+void UDiceDebrisManager::RemoveEntry(int32 Index)
+{
+	if (!Debris[Index].bFrozen)
+	{
+		NumAwake--;
+	}
+	Debris.RemoveAt(Index);  // Keeps the age order
+}
+
+// ==================== TICK ====================
+
+void UDiceDebrisManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_DiceDebrisTick);
+
+	if (NumAwake > 0)
+	{
+		const float RestSpeed = CVarDiceDebrisRestSpeed.GetValueOnGameThread();
+		const float RestSpeedSq = FMath::Square(RestSpeed);
+		const float RestSpinSq = FMath::Square(RestSpeed * 4.0f);
+		const float RestTime = CVarDiceDebrisRestTime.GetValueOnGameThread();
+		const float MaxAwakeTime = CVarDiceDebrisMaxAwakeTime.GetValueOnGameThread();
+
+		for (int32 i = Debris.Num() - 1; i >= 0; i--)
+		{
+			FDebris& Entry = Debris[i];
+			if (Entry.bFrozen)
+			{
+				continue;
+			}
+
+			UPrimitiveComponent* Body = Entry.Body.Get();
+			if (!Body)
+			{
+				RemoveEntry(i);
+				continue;
+			}
+
+			// Someone else took it out of the simulation
+			if (!Body->IsSimulatingPhysics())
+			{
+				Entry.bFrozen = true;
+				NumAwake--;
+				continue;
+			}
+
+			Entry.AwakeTime += DeltaTime;
+
+			const bool bResting = !Body->RigidBodyIsAwake()
+				|| (Body->GetPhysicsLinearVelocity().SizeSquared() < RestSpeedSq
+					&& Body->GetPhysicsAngularVelocityInDegrees().SizeSquared() < RestSpinSq);
+			Entry.RestTime = bResting ? Entry.RestTime + DeltaTime : 0.0f;
+
+			if (Entry.RestTime >= RestTime || Entry.AwakeTime >= MaxAwakeTime)
+			{
+				Freeze(Entry);
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_DiceDebrisTracked, Debris.Num());
+	SET_DWORD_STAT(STAT_DiceDebrisAwake, NumAwake);
+}
+
+void UDiceDebrisManager::Freeze(FDebris& Entry)
+{
+	// Stays where it landed as a kinematic body - no solver cost, still collides with the dice
+	if (UPrimitiveComponent* Body = Entry.Body.Get())
+	{
+		Body->SetSimulatePhysics(false);
+	}
+	Entry.bFrozen = true;
+	NumAwake--;
+}
+
+void UDiceDebrisManager::Retire(UPrimitiveComponent* Body)
+{
+	if (!Body) return;
+
+	Body->SetSimulatePhysics(false);
+	Body->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Body->SetVisibility(false);
+}
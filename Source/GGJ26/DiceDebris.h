@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DiceDebris.generated.h"
+
+class UPrimitiveComponent;
+
+// Lifecycle for thrown-off physics bodies - severed fingers, dropped knives, the player's mask.
+// A tracked body is frozen where it landed (simulation off, collision kept so dice still hit it) once it comes to rest,
+// and past dice.Debris.Max the oldest is retired (hidden, collision off). The simulated body count stays flat
+// however many rounds are played; only bodies still in flight cost anything per frame.
+UCLASS()
+class UDiceDebrisManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UDiceDebrisManager();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UDiceDebrisManager* Get(const UObject* WorldContext);
+
+	// Start watching a body that was just set simulating. Tracking it again makes it the newest.
+	void Track(UPrimitiveComponent* Body);
+
+	// Forget a body without touching it (e.g. its owner parks it for reuse)
+	void Untrack(UPrimitiveComponent* Body);
+
+	int32 GetNumTracked() const { return Debris.Num(); }
+	int32 GetNumAwake() const { return NumAwake; }
+
+private:
+	struct FDebris
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Body;
+		float RestTime = 0.0f;   // Seconds spent under the rest thresholds
+		float AwakeTime = 0.0f;  // Seconds since it was tracked
+		bool bFrozen = false;
+	};
+	TArray<FDebris> Debris;  // Oldest first
+	int32 NumAwake;
+
+	void Freeze(FDebris& Entry);
+	void RemoveEntry(int32 Index);
+	static void Retire(UPrimitiveComponent* Body);
+};
@@ -0,0 +1,114 @@
+#include "DiceDebugOverlay.h"
+#include "GGJ26.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+#if DICE_DEBUG_DRAW
+static TAutoConsoleVariable<bool> CVarDiceDebugDraw(
+	TEXT("dice.Debug.Draw"),
+	false,
+	TEXT("Draw dice face numbers through the debug overlay, regardless of per-actor debug flags."),
+	ECVF_Cheat);
+
+static TAutoConsoleVariable<bool> CVarDiceDebugBonusCamera(
+	TEXT("dice.Debug.BonusCamera"),
+	false,
+	TEXT("Lock the dice camera to the bonus round button view."),
+	ECVF_Cheat);
+#endif
+
+// Safety cap in case nothing is drawing the overlay (e.g. no viewport)
+static constexpr int32 MaxPendingText = 2048;
+
+bool UDiceDebugOverlay::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if DICE_DEBUG_DRAW
+	return Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+void UDiceDebugOverlay::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UDiceDebugOverlay::DrawOverlay));
+}
+
+void UDiceDebugOverlay::Deinitialize()
+{
+	if (DrawHandle.IsValid())
+	{
+		UDebugDrawService::Unregister(DrawHandle);
+		DrawHandle.Reset();
+	}
+	PendingText.Empty();
+
+	Super::Deinitialize();
+}
+
+UDiceDebugOverlay* UDiceDebugOverlay::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UDiceDebugOverlay>() : nullptr;
+}
+
+void UDiceDebugOverlay::AddWorldText(const FVector& Location, const FString& Text, const FColor& Color, float Scale)
+{
+	if (PendingText.Num() >= MaxPendingText)
+	{
+		return;
+	}
+
+	FDebugText& Entry = PendingText.AddDefaulted_GetRef();
+	Entry.Location = Location;
+	Entry.Text = Text;
+	Entry.Color = Color;
+	Entry.Scale = Scale;
+}
+
+bool UDiceDebugOverlay::IsDebugDrawEnabled()
+{
+#if DICE_DEBUG_DRAW
+	return CVarDiceDebugDraw.GetValueOnGameThread();
+#else
+	return false;
+#endif
+}
+
+bool UDiceDebugOverlay::IsBonusCameraLocked()
+{
+#if DICE_DEBUG_DRAW
+	return CVarDiceDebugBonusCamera.GetValueOnGameThread();
+#else
+	return false;
+#endif
+}
+
+void UDiceDebugOverlay::DrawOverlay(UCanvas* Canvas, APlayerController* PC)
+{
+	if (PendingText.Num() == 0 || !Canvas || !PC || PC->GetWorld() != GetWorld())
+	{
+		return;
+	}
+
+	UFont* Font = GEngine->GetSmallFont();
+
+	for (const FDebugText& Entry : PendingText)
+	{
+		FVector ScreenPos = Canvas->Project(Entry.Location);
+		if (ScreenPos.Z <= 0.0f)
+		{
+			continue;  // Behind the camera
+		}
+
+		Canvas->SetDrawColor(Entry.Color);
+		Canvas->DrawText(Font, Entry.Text, ScreenPos.X, ScreenPos.Y, Entry.Scale, Entry.Scale);
+	}
+
+	PendingText.Reset();
+}
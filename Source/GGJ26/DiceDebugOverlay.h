@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DiceDebugOverlay.generated.h"
+
+class UCanvas;
+class APlayerController;
+
+// Collects debug world text during the frame and draws all of it in one canvas pass.
+// Only created outside Shipping/Test builds (see DICE_DEBUG_DRAW).
+UCLASS()
+class UDiceDebugOverlay : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	static UDiceDebugOverlay* Get(const UWorld* World);
+
+	// Queue a label at a world position - it is drawn once and then cleared
+	void AddWorldText(const FVector& Location, const FString& Text, const FColor& Color, float Scale = 1.0f);
+
+	// ===== CONSOLE VARIABLES =====
+	static bool IsDebugDrawEnabled();    // dice.Debug.Draw
+	static bool IsBonusCameraLocked();   // dice.Debug.BonusCamera
+
+private:
+	struct FDebugText
+	{
+		FVector Location;
+		FString Text;
+		FColor Color;
+		float Scale;
+	};
+
+	TArray<FDebugText> PendingText;
+	FDelegateHandle DrawHandle;
+
+	void DrawOverlay(UCanvas* Canvas, APlayerController* PC);
+};
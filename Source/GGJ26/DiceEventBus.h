@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DiceEventBus.generated.h"
+
+class ADice;
+class UPlayerHandComponent;
+class URoundTimerComponent;
+class UHangingBoardComponent;
+class UIRButtonComponent;
+enum class EIRButtonType : uint8;
+
+// ===== EVENTS =====
+struct FDiceChopCompleteEvent   { UPlayerHandComponent* Hand; };
+struct FDiceTimerExpiredEvent   { URoundTimerComponent* Timer; };
+struct FDiceBoardArrivedEvent   { UHangingBoardComponent* Board; };
+struct FDiceBoardRetractedEvent { UHangingBoardComponent* Board; };
+struct FDiceButtonPressedEvent  { UIRButtonComponent* Button; EIRButtonType ButtonType; };
+struct FDiceRolledEvent         { int32 Result; };
+struct FDiceGameStartedEvent    {};
+struct FDiceGameEndedEvent      { bool bWon; };
+
+// High-frequency - native only, no Blueprint mirror
+struct FDiceSettledEvent        { ADice* Dice; int32 Value; bool bEnemy; };
+struct FDiceHoveredEvent        { ADice* Dice; ADice* Previous; };  // Dice is null when the hover leaves
+struct FDiceMatchEvent          { ADice* PlayerDice; ADice* EnemyDice; int32 Value; };
+
+template<typename TEvent>
+using TDiceEvent = TMulticastDelegate<void(const TEvent&)>;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDiceBenchmarkDynamicEvent, int32, Value);
+
+// Typed gameplay event bus for C++ listeners.
+// Publishing is a plain native delegate call - no reflection, no ProcessEvent.
+// The components' BlueprintAssignable delegates are kept as a Blueprint-facing mirror only.
+UCLASS()
+class UDiceEventBus : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	static UDiceEventBus* Get(const UObject* WorldContext);
+
+	// Subscribe: Bus->On<FDiceMatchEvent>().AddUObject(...)
+	template<typename TEvent>
+	TDiceEvent<TEvent>& On() { return Channel<TEvent>(); }
+
+	template<typename TEvent>
+	void Publish(const TEvent& Event) { Channel<TEvent>().Broadcast(Event); }
+
+	// Publish on WorldContext's bus (for low-frequency senders that don't keep a pointer)
+	template<typename TEvent>
+	static void Broadcast(const UObject* WorldContext, const TEvent& Event)
+	{
+		if (UDiceEventBus* Bus = Get(WorldContext))
+		{
+			Bus->Publish(Event);
+		}
+	}
+
+	// dice.Events.Benchmark - native vs dynamic broadcast cost
+	void RunBenchmark(int32 Iterations);
+
+private:
+	template<typename TEvent>
+	TDiceEvent<TEvent>& Channel();
+
+	TDiceEvent<FDiceChopCompleteEvent> ChopComplete;
+	TDiceEvent<FDiceTimerExpiredEvent> TimerExpired;
+	TDiceEvent<FDiceBoardArrivedEvent> BoardArrived;
+	TDiceEvent<FDiceBoardRetractedEvent> BoardRetracted;
+	TDiceEvent<FDiceButtonPressedEvent> ButtonPressed;
+	TDiceEvent<FDiceRolledEvent> DiceRolled;
+	TDiceEvent<FDiceGameStartedEvent> GameStarted;
+	TDiceEvent<FDiceGameEndedEvent> GameEnded;
+	TDiceEvent<FDiceSettledEvent> DiceSettled;
+	TDiceEvent<FDiceHoveredEvent> DiceHovered;
+	TDiceEvent<FDiceMatchEvent> MatchMade;
+
+	// Benchmark listeners
+	FDiceBenchmarkDynamicEvent BenchmarkDynamic;
+	int32 BenchmarkSum;
+
+	UFUNCTION()
+	void OnBenchmarkDynamic(int32 Value);
+	void OnBenchmarkNative(const FDiceRolledEvent& Event);
+};
+
+#define DICE_EVENT_CHANNEL(EventType, Member) \
+	template<> inline TDiceEvent<EventType>& UDiceEventBus::Channel<EventType>() { return Member; }
+
+DICE_EVENT_CHANNEL(FDiceChopCompleteEvent, ChopComplete)
+DICE_EVENT_CHANNEL(FDiceTimerExpiredEvent, TimerExpired)
+DICE_EVENT_CHANNEL(FDiceBoardArrivedEvent, BoardArrived)
+DICE_EVENT_CHANNEL(FDiceBoardRetractedEvent, BoardRetracted)
+DICE_EVENT_CHANNEL(FDiceButtonPressedEvent, ButtonPressed)
+DICE_EVENT_CHANNEL(FDiceRolledEvent, DiceRolled)
+DICE_EVENT_CHANNEL(FDiceGameStartedEvent, GameStarted)
+DICE_EVENT_CHANNEL(FDiceGameEndedEvent, GameEnded)
+DICE_EVENT_CHANNEL(FDiceSettledEvent, DiceSettled)
+DICE_EVENT_CHANNEL(FDiceHoveredEvent, DiceHovered)
+DICE_EVENT_CHANNEL(FDiceMatchEvent, MatchMade)
+
+#undef DICE_EVENT_CHANNEL
@@ -8,17 +8,85 @@
 #include "IRButtonComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
+#include "DiceDebugOverlay.h"
+#include "DiceTimerWheel.h"
+#include "DiceEventBus.h"
+#include "DiceSignificance.h"
+#include "DiceTextRevealComponent.h"
+#include "DiceLabelBatcher.h"
+#include "DiceDebris.h"
 #include "GameFramework/PlayerController.h"
 #include "Components/InputComponent.h"
 #include "Components/TextRenderComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Blueprint/UserWidget.h"
 #include "Components/Image.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Engine/GameViewportClient.h"
+#include "Slate/SceneViewport.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "RenderingThread.h"
+
+static TAutoConsoleVariable<bool> CVarDiceLegacyPacing(
+	TEXT("dice.Pacing.LegacyWaits"),
+	false,
+	TEXT("Use the old fixed waits (1.5s after dice settle, 0.6s before RE:ALL, full camera pan before chop) to compare pacing."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarDiceSerialAnimations(
+	TEXT("dice.Input.SerialAnimations"),
+	false,
+	TEXT("Block all matching input while any die is animating (old behaviour) to compare actions per second."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarDiceLegacyDrag(
+	TEXT("dice.Input.LegacyDrag"),
+	false,
+	TEXT("Move the dragged die in the normal tick from the frame-start cursor position (old behaviour) to compare drag latency."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarDiceLatencyTrace(
+	TEXT("dice.Input.LatencyTrace"),
+	false,
+	TEXT("Log input -> present timestamps for the dragged die (click-to-motion and per-frame cursor-to-present)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceSequenceHitchBudget(
+	TEXT("dice.Sequence.HitchBudgetMs"),
+	16.7f,
+	TEXT("Frame time budget for the frame a win/lose sequence starts in. The frame is logged, with a warning when it runs over."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarDiceSequenceWarmUp(
+	TEXT("dice.Sequence.WarmUp"),
+	true,
+	TEXT("Create the fade widget, spawn the player mask and prime sounds at BeginPlay (0 = create them when the sequence starts, old behaviour)."),
+	ECVF_ReadOnly);
+
+DECLARE_CYCLE_STAT(TEXT("Sequence Start"), STAT_DiceSequenceStart, STATGROUP_DiceGame);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Sequence Start Call (ms)"), STAT_DiceSequenceStartCallMs, STATGROUP_DiceGame);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Sequence Start Frame (ms)"), STAT_DiceSequenceStartFrameMs, STATGROUP_DiceGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sequence Hitches"), STAT_DiceSequenceHitches, STATGROUP_DiceGame);
+
+#if DICE_DEBUG_DRAW
+static TAutoConsoleVariable<bool> CVarDiceDebugHudText(
+	TEXT("dice.Debug.HudText"),
+	false,
+	TEXT("Print the turn prompt, dice results and health as on-screen debug messages every frame."),
+	ECVF_Cheat);
+#endif
 
 ADiceGameManager::ADiceGameManager()
 {
 	PrimaryActorTick.bCanEverTick = true;
 
+	// Late tick for the dragged die - registered alongside the primary tick
+	LateUpdateTick.bCanEverTick = true;
+	LateUpdateTick.bStartWithTickEnabled = true;
+	LateUpdateTick.TickGroup = TG_PostUpdateWork;
+
 	// Setup
 	EnemyNumDice = 4;
 	PlayerNumDice = 5;
@@ -54,10 +122,22 @@ ADiceGameManager::ADiceGameManager()
 	MatchCameraOffset = FVector(-150.0f, 0.0f, 200.0f);
 	MatchCameraPitch = -55.0f;
 	CameraPanSpeed = 2.0f;
+	CameraArriveTolerance = 10.0f;
+
+	// Pacing
+	SettleMinDwell = 0.5f;
+	SettleConfirmTime = 0.15f;
+	DiceStillSinceTime = 0.0;
+	bCameraArrived = false;
+	bRerollThrowQueued = false;
+	PacingRound = 0;
+	PacingRoundStartTime = 0.0;
+	PacingDeadWait = 0.0f;
+	PacingTransitions = 0;
 
 	// Dragging
 	DragHeight = 40.0f;
-	DragFollowSpeed = 30.0f;
+	DragFollowSpeed = 40.0f;  // ~0.5 of the gap per frame at 60fps
 	DragTiltAmount = 3.0f;
 
 	// Health
@@ -71,8 +151,7 @@ ADiceGameManager::ADiceGameManager()
 	bPlayerDiceSettled = false;
 	LineupProgress = 0.0f;
 	PlayerLineupProgress = 0.0f;
-	WaitTimer = 0.0f;
-	bShowDebugGizmos = true;
+	bShowDebugGizmos = false;
 
 	SelectedPlayerDice = nullptr;
 	SelectedDiceIndex = -1;
@@ -80,6 +159,7 @@ ADiceGameManager::ADiceGameManager()
 	HoveredEnemyIndex = -1;
 	HoveredModifierIndex = -1;
 	LastHoveredDice = nullptr;
+	EventBus = nullptr;
 
 	// Adjust mode - disabled by default
 	bAdjustMode = false;
@@ -106,45 +186,27 @@ ADiceGameManager::ADiceGameManager()
 	OriginalDragPosition = FVector::ZeroVector;
 	OriginalDragRotation = FRotator::ZeroRotator;
 	LastDragPosition = FVector::ZeroVector;
+	DragStartInputTime = 0.0;
+	bDragFirstMotion = false;
 
-	// Return animation
-	bDiceReturning = false;
-	ReturningDice = nullptr;
-	ReturningDiceIndex = -1;
-	ReturnProgress = 0.0f;
-	ReturnVelocity = FVector::ZeroVector;
-
-	// Modifier snap animation
-	bDiceSnappingToModifier = false;
-	SnapTargetModifier = nullptr;
-	SnapDiceIndex = -1;
-
-	// Modifier effect animation
-	bDiceFlipping = false;
-	FlipDiceIndex = -1;
-	FlipProgress = 0.0f;
+	// Matching throughput
+	MatchingActiveTime = 0.0f;
+	MatchingActionCount = 0;
+	MatchingQueuedCount = 0;
 
 	// Reroll from modifier
-	bRerollAfterSnap = false;
-	RerollDiceIndex = -1;
-	bRerollAll = false;
 	bWaitingForCameraToRerollAll = false;
-	RerollAllWaitTimer = 0.0f;
 	bDiceLiftingForReroll = false;
 	DiceLiftProgress = 0.0f;
 
-	// Match animation
-	bMatchAnimating = false;
-	MatchPlayerIndex = -1;
-	MatchEnemyIndex = -1;
-	MatchAnimProgress = 0.0f;
-
 	// Camera
 	CameraPanProgress = 0.0f;
 	bCameraPanning = false;
 	bCameraAtMatchView = false;
 	OriginalCameraLocation = FVector::ZeroVector;
 	OriginalCameraRotation = FRotator::ZeroRotator;
+	CameraPanLocation = FVector::ZeroVector;
+	CameraPanRotation = FRotator::ZeroRotator;
 
 	// Modifier shuffle
 	bModifierShuffling = false;
@@ -157,12 +219,14 @@ ADiceGameManager::ADiceGameManager()
 	PlayerHandActor = nullptr;
 	EnemyHandActor = nullptr;
 	bWaitingForChop = false;
-	bWaitingForCameraThenEnemyChop = false;
 
 	// Dice disperse
 	bDiceDispersing = false;
 	DiceDisperseProgress = 0.0f;
 
+	// Next round staging
+	bStagingNextRound = false;
+
 	// Round timer
 	RoundTimerActor = nullptr;
 	CachedRoundTimer = nullptr;
@@ -188,31 +252,21 @@ ADiceGameManager::ADiceGameManager()
 	BonusCameraPitch = 0.0f;       // 0 = auto look at buttons, or override
 	BonusCameraFocusSpeed = 2.5f;
 	bDebugBonusCamera = false;
+	BonusSettleTimeout = 1.5f;
 
 	// Masquerade UI
 	MasqueradeUIActor = nullptr;
 	MasqueradeUIText = nullptr;
 	TypewriterSpeed = 15.0f;  // Characters per second
 	GlitchChance = 0.3f;      // 30% chance of glitch per character
-	TypewriterTimer = 0.0f;
-	TypewriterIndex = 0;
-	bTypewriterActive = false;
-	bTypewriterOut = false;
-	GlitchTimer = 0.0f;
-	bShowingGlitch = false;
-	GlitchChars = TEXT("@#$%&*!?<>[]{}|/\\");
+	MasqueradeReveal = nullptr;
 
 	// Dice Label (fold prompt)
 	DiceLabelActor = nullptr;
 	DiceLabelTextComp = nullptr;
 	DiceLabelText = TEXT("SPACE TO FOLD");
 	DiceLabelTypeSpeed = 20.0f;
-	DiceLabelFullText = TEXT("");
-	DiceLabelCurrentText = TEXT("");
-	DiceLabelTypeTimer = 0.0f;
-	DiceLabelTypeIndex = 0;
-	bDiceLabelTypewriterActive = false;
-	bDiceLabelTypewriterOut = false;
+	DiceLabelReveal = nullptr;
 
 	// Masked dice
 	MaskedDiceMesh = nullptr;
@@ -225,6 +279,8 @@ ADiceGameManager::ADiceGameManager()
 	BonusPhase = 0;  // Inactive
 	BonusPlayerDice = nullptr;
 	BonusRevealDice = nullptr;
+	BonusEnemyFaces[0] = 1;
+	BonusEnemyFaces[1] = 1;
 	BonusEnemyTotal = 0;
 	bBonusIsHigher = false;
 	bPlayerGuessedHigher = false;
@@ -250,10 +306,6 @@ ADiceGameManager::ADiceGameManager()
 	BonusRevealPhase = 0;
 	RevealShakeTimer = 0.0f;
 	RevealStrikeProgress = 0.0f;
-	BonusPlayerVelocity = FVector::ZeroVector;
-	BonusRevealVelocity = FVector::ZeroVector;
-	BonusPlayerRotSpeed = 0.0f;
-	BonusRevealRotSpeed = 0.0f;
 	BonusBounceCount = 0;
 	BonusResultFloorZ = 0.0f;
 
@@ -265,18 +317,15 @@ ADiceGameManager::ADiceGameManager()
 	BonusCameraShakeOffset = FVector::ZeroVector;
 
 	// Win sequence
+	WinTimeline = nullptr;
+	DefaultWinTimeline = nullptr;
 	WinSequencePhase = 0;
-	WinSequenceTimer = 0.0f;
-	WinSequenceProgress = 0.0f;
-	WinMaskRotationProgress = 0.0f;
-	WinFadeAlpha = 0.0f;
+	WinMaskFloatStartTime = 0.0f;
 	FadeWidgetClass = nullptr;
 
 	// Win camera breathing
 	bWinCameraBreathing = false;
 	WinCameraBreathTimer = 0.0f;
-	WinCameraBasePos = FVector::ZeroVector;
-	WinCameraBaseRot = FRotator::ZeroRotator;
 
 	// Mask mesh animation
 	WinMaskMeshStartPos = FVector::ZeroVector;
@@ -292,18 +341,25 @@ ADiceGameManager::ADiceGameManager()
 	PlayerMaskDropScale = 0.1f;
 	PlayerMaskDropRotation = FRotator(-90.0f, 0.0f, 0.0f);  // Facing down by default
 	LoseCameraForwardOffset = 50.0f;  // Move forward a bit by default
+	LoseTimeline = nullptr;
+	DefaultLoseTimeline = nullptr;
 	LoseSequencePhase = 0;
-	LoseSequenceTimer = 0.0f;
-	LoseSequenceProgress = 0.0f;
-	LoseFadeAlpha = 0.0f;
 	LoseCameraStartPos = FVector::ZeroVector;
 	LoseCameraStartRot = FRotator::ZeroRotator;
 	LoseCameraTargetRot = FRotator::ZeroRotator;
 	bLoseCameraBreathing = false;
 	LoseCameraBreathTimer = 0.0f;
+	PlayerMaskActor = nullptr;
 	DroppedPlayerMask = nullptr;
 	PlayerMaskDropStartPos = FVector::ZeroVector;
 	DroppedKnife = nullptr;
+	SequenceKnife = nullptr;
+
+	// Sequence hitch capture
+	SequenceHitchLabel = TEXT("");
+	SequenceStartMs = 0.0;
+	SequenceStartFrame = 0;
+	bSequenceHitchPending = false;
 }
 
 void ADiceGameManager::BeginPlay()
@@ -318,7 +374,8 @@ void ADiceGameManager::BeginPlay()
 		DiceLabelTextComp = DiceLabelActor->FindComponentByClass<UTextRenderComponent>();
 		if (DiceLabelTextComp)
 		{
-			DiceLabelTextComp->SetText(FText::FromString(TEXT("")));
+			UDiceLabelBatcher::Adopt(DiceLabelTextComp);
+			UDiceLabelBatcher::SetText(DiceLabelTextComp, FText::GetEmpty());
 		}
 		DiceLabelActor->SetActorHiddenInGame(true);
 	}
@@ -331,41 +388,36 @@ void ADiceGameManager::BeginPlay()
 		OriginalCameraRotation = Cam->GetActorRotation();
 	}
 
-	// Bind to hand chop events
-	UPlayerHandComponent* PlayerHand = GetPlayerHand();
-	if (PlayerHand)
-	{
-		PlayerHand->OnChopComplete.AddDynamic(this, &ADiceGameManager::OnPlayerChopComplete);
-	}
-	UPlayerHandComponent* EnemyHand = GetEnemyHand();
-	if (EnemyHand)
+	// Listen on the native event bus - the components' dynamic delegates are left for Blueprint
+	EventBus = UDiceEventBus::Get(this);
+	if (EventBus)
 	{
-		EnemyHand->OnChopComplete.AddDynamic(this, &ADiceGameManager::OnEnemyChopComplete);
-	}
+		// Hand chop events
+		EventBus->On<FDiceChopCompleteEvent>().AddWeakLambda(this, [this](const FDiceChopCompleteEvent& Event)
+		{
+			if (Event.Hand == GetPlayerHand()) OnPlayerChopComplete();
+			else if (Event.Hand == GetEnemyHand()) OnEnemyChopComplete();
+		});
 
-	// Bind to round timer expired event
-	URoundTimerComponent* Timer = GetRoundTimer();
-	if (Timer)
-	{
-		Timer->OnTimerExpired.AddDynamic(this, &ADiceGameManager::OnRoundTimerExpired);
-	}
+		// Round timer expired
+		EventBus->On<FDiceTimerExpiredEvent>().AddWeakLambda(this, [this](const FDiceTimerExpiredEvent& Event)
+		{
+			if (Event.Timer == GetRoundTimer()) OnRoundTimerExpired();
+		});
 
-	// Bind to bonus round events
-	UHangingBoardComponent* Board = GetHangingBoard();
-	if (Board)
-	{
-		Board->OnBoardArrived.AddDynamic(this, &ADiceGameManager::OnBoardArrived);
-		Board->OnBoardRetracted.AddDynamic(this, &ADiceGameManager::OnBoardRetracted);
-	}
-	UIRButtonComponent* YesBtn = GetYesButton();
-	if (YesBtn)
-	{
-		YesBtn->OnButtonPressed.AddDynamic(this, &ADiceGameManager::OnBonusButtonPressed);
-	}
-	UIRButtonComponent* NoBtn = GetNoButton();
-	if (NoBtn)
-	{
-		NoBtn->OnButtonPressed.AddDynamic(this, &ADiceGameManager::OnBonusButtonPressed);
+		// Bonus round events
+		EventBus->On<FDiceBoardArrivedEvent>().AddWeakLambda(this, [this](const FDiceBoardArrivedEvent& Event)
+		{
+			if (Event.Board == GetHangingBoard()) OnBoardArrived();
+		});
+		EventBus->On<FDiceBoardRetractedEvent>().AddWeakLambda(this, [this](const FDiceBoardRetractedEvent& Event)
+		{
+			if (Event.Board == GetHangingBoard()) OnBoardRetracted();
+		});
+		EventBus->On<FDiceButtonPressedEvent>().AddWeakLambda(this, [this](const FDiceButtonPressedEvent& Event)
+		{
+			if (Event.Button == GetYesButton() || Event.Button == GetNoButton()) OnBonusButtonPressed(Event.ButtonType);
+		});
 	}
 
 	// Hide Masquerade UI by default
@@ -373,6 +425,11 @@ void ADiceGameManager::BeginPlay()
 	{
 		MasqueradeUIActor->SetActorHiddenInGame(true);
 	}
+
+	if (CVarDiceSequenceWarmUp.GetValueOnGameThread())
+	{
+		WarmUpSequences();
+	}
 }
 
 void ADiceGameManager::SetupInputBindings()
@@ -386,10 +443,12 @@ void ADiceGameManager::SetupInputBindings()
 			// E is now the main action key - starts game, throws dice, continues
 			InputComponent->BindKey(EKeys::E, IE_Pressed, this, &ADiceGameManager::OnPlayerActionPressed);
 			InputComponent->BindKey(EKeys::G, IE_Pressed, this, &ADiceGameManager::OnStartGamePressed);  // Keep G as backup
+#if DICE_DEBUG_DRAW
 			InputComponent->BindKey(EKeys::T, IE_Pressed, this, &ADiceGameManager::OnToggleDebugPressed);
 			InputComponent->BindKey(EKeys::F, IE_Pressed, this, &ADiceGameManager::OnToggleFaceRotationMode);
 			InputComponent->BindKey(EKeys::X, IE_Pressed, this, &ADiceGameManager::OnDebugKillEnemy);  // Debug damage enemy
 			InputComponent->BindKey(EKeys::Z, IE_Pressed, this, &ADiceGameManager::OnDebugKillPlayer); // Debug damage player
+#endif
 			InputComponent->BindKey(EKeys::LeftMouseButton, IE_Pressed, this, &ADiceGameManager::OnMousePressed);
 			InputComponent->BindKey(EKeys::LeftMouseButton, IE_Released, this, &ADiceGameManager::OnMouseReleased);
 			InputComponent->BindKey(EKeys::SpaceBar, IE_Pressed, this, &ADiceGameManager::OnGiveUpPressed);
@@ -422,10 +481,55 @@ void ADiceGameManager::FindAllModifiers()
 	}
 }
 
+void FDiceLateUpdateTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Manager && IsValid(Manager) && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Manager->LateTick(DeltaTime * Manager->CustomTimeDilation);
+	}
+}
+
+FString FDiceLateUpdateTickFunction::DiagnosticMessage()
+{
+	return Manager ? Manager->GetFullName() + TEXT("[LateTick]") : TEXT("DiceGameManager[LateTick]");
+}
+
+void ADiceGameManager::RegisterActorTickFunctions(bool bRegister)
+{
+	Super::RegisterActorTickFunctions(bRegister);
+
+	if (bRegister)
+	{
+		if (PrimaryActorTick.IsTickFunctionRegistered() && !LateUpdateTick.IsTickFunctionRegistered())
+		{
+			LateUpdateTick.Manager = this;
+			LateUpdateTick.SetTickFunctionEnable(LateUpdateTick.bStartWithTickEnabled);
+			LateUpdateTick.RegisterTickFunction(GetLevel());
+		}
+	}
+	else if (LateUpdateTick.IsTickFunctionRegistered())
+	{
+		LateUpdateTick.UnRegisterTickFunction();
+	}
+}
+
+void ADiceGameManager::LateTick(float DeltaTime)
+{
+	// Last thing before the frame is rendered - sample the cursor now rather than at the start of the frame
+	if (bIsDragging && CurrentPhase == EGamePhase::PlayerMatching && !CVarDiceLegacyDrag.GetValueOnGameThread())
+	{
+		UpdateDragging(DeltaTime, true);
+
+		// The batcher already sampled this frame's transforms - bring the dragged die's face numbers along
+		UDiceLabelBatcher::RefreshLabelsOf(DraggedDice);
+	}
+}
+
 void ADiceGameManager::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+#if DICE_DEBUG_DRAW
 	if (bFaceRotationMode)
 	{
 		UpdateFaceRotationMode();
@@ -436,15 +540,29 @@ void ADiceGameManager::Tick(float DeltaTime)
 		DrawAdjustGizmos();
 	}
 
-	DrawTurnText();
-	DrawHealthBars();
+	// Formats and queues several strings a frame - only when asked for
+	if (CVarDiceDebugHudText.GetValueOnGameThread())
+	{
+		DrawTurnText();
+		DrawHealthBars();
+	}
+#endif
 
 	// Always update camera pan (so it works during all phases)
 	UpdateCameraPan(DeltaTime);
 
+	// Stage next round's dice while the chop plays
+	if (bStagingNextRound)
+	{
+		UpdateNextRoundStaging();
+	}
+
 	// Update bonus round camera
 	UpdateBonusCameraFocus(DeltaTime);
 
+	// Move every scripted arc before the effects that read them
+	Ballistics.Step(DeltaTime);
+
 	// Update bonus round gameplay
 	UpdateBonusRound(DeltaTime);
 
@@ -454,20 +572,15 @@ void ADiceGameManager::Tick(float DeltaTime)
 	// Update bonus camera shake
 	UpdateBonusCameraShake(DeltaTime);
 
-	// Update masquerade UI typewriter effect
-	UpdateMasqueradeTypewriter(DeltaTime);
-
-	// Update dice label typewriter effect
-	UpdateDiceLabelTypewriter(DeltaTime);
-
 	// Update win sequence
 	UpdateWinSequence(DeltaTime);
 
 	// Update lose sequence
 	UpdateLoseSequence(DeltaTime);
 
+#if DICE_DEBUG_DRAW
 	// Debug: lock camera to bonus button view
-	if (bDebugBonusCamera)
+	if (bDebugBonusCamera || UDiceDebugOverlay::IsBonusCameraLocked())
 	{
 		// Calculate bonus camera position
 		FVector ButtonCenter = FVector::ZeroVector;
@@ -498,10 +611,14 @@ void ADiceGameManager::Tick(float DeltaTime)
 		ADiceCamera* Cam = FindCamera();
 		if (Cam)
 		{
-			Cam->SetActorLocation(DebugCamPos);
-			Cam->SetActorRotation(DebugCamRot);
+			Cam->SetPoseLayer(ECameraLayer::DebugLock, DebugCamPos, DebugCamRot);
 		}
 	}
+	else if (ADiceCamera* Cam = FindCamera())
+	{
+		Cam->ClearPoseLayer(ECameraLayer::DebugLock);
+	}
+#endif
 
 	// Update dice disperse animation
 	UpdateDiceDisperse(DeltaTime);
@@ -527,20 +644,12 @@ void ADiceGameManager::Tick(float DeltaTime)
 		case EGamePhase::PlayerMatching:
 			UpdateMatchingPhase();
 			UpdateMouseInput();
-			UpdateDiceReturn(DeltaTime);
-			UpdateModifierSnap(DeltaTime);
-			UpdateDiceFlip(DeltaTime);
-			UpdateMatchAnimation(DeltaTime);
+			UpdatePlayerDiceAnims(DeltaTime);
 			UpdateModifierShuffle(DeltaTime);
-			// Check if waiting for camera to reset before RE:ALL
-			if (bWaitingForCameraToRerollAll)
+			ProcessQueuedInputs();
+			if (PlayerDice.Num() > 0)
 			{
-				RerollAllWaitTimer += DeltaTime;
-				if (RerollAllWaitTimer >= 0.6f)  // Wait for camera to start moving
-				{
-					bWaitingForCameraToRerollAll = false;
-					StartDiceLiftForReroll();
-				}
+				MatchingActiveTime += DeltaTime;
 			}
 			// Animate dice lifting before throw
 			if (bDiceLiftingForReroll)
@@ -643,6 +752,7 @@ void ADiceGameManager::OnPlayerActionPressed()
 	}
 }
 
+#if DICE_DEBUG_DRAW
 void ADiceGameManager::OnToggleDebugPressed()
 {
 	bShowDebugGizmos = !bShowDebugGizmos;
@@ -666,6 +776,7 @@ void ADiceGameManager::OnToggleFaceRotationMode()
 		}
 	}
 }
+#endif
 
 void ADiceGameManager::OnSelectNext() {}
 void ADiceGameManager::OnSelectPrev() {}
@@ -676,14 +787,17 @@ void ADiceGameManager::OnGiveUpPressed()
 {
 	if (CurrentPhase == EGamePhase::PlayerMatching)
 	{
-		// Only allow if not in the middle of animations
-		if (!bDiceReturning && !bDiceSnappingToModifier && !bDiceFlipping && !bMatchAnimating && !bWaitingForCameraToRerollAll && !bDiceLiftingForReroll && !bIsDragging && !bModifierShuffling)
+		// Not in the middle of animations - give up as soon as they finish instead
+		if (IsGiveUpBlocked())
 		{
-			GiveUpRound();
+			QueueInput(EQueuedInput::GiveUp, nullptr);
+			return;
 		}
+		GiveUpRound();
 	}
 }
 
+#if DICE_DEBUG_DRAW
 void ADiceGameManager::OnDebugKillEnemy()
 {
 	// Debug - reduce enemy health by 1
@@ -697,6 +811,7 @@ void ADiceGameManager::OnDebugKillPlayer()
 	PlayerHealth = FMath::Max(0, PlayerHealth - 1);
 	GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Red, FString::Printf(TEXT("DEBUG: Player HP = %d"), PlayerHealth));
 }
+#endif
 
 void ADiceGameManager::UpdateDiceDebugVisibility()
 {
@@ -716,6 +831,7 @@ void ADiceGameManager::StartGame()
 	HideDiceLabel();
 
 	ClearAllDice();
+	DiscardStagedRound();
 
 	EnemyResults.Empty();
 	PlayerResults.Empty();
@@ -723,10 +839,22 @@ void ADiceGameManager::StartGame()
 	EnemyDiceMatched.Empty();
 	PlayerDiceModified.Empty();
 	PlayerDiceAtModifier.Empty();
-	WaitTimer = 0.0f;
+	ResetDiceAnims();
+	for (int32 Gate = 0; Gate < (int32)EPhaseGate::Count; Gate++)
+	{
+		CancelPhaseGate((EPhaseGate)Gate);
+	}
+	bRerollThrowQueued = false;
 	SelectionMode = 0;
 	SelectedDiceIndex = -1;
 
+	// Drop anything a previous win/lose sequence left on the camera
+	if (ADiceCamera* Cam = FindCamera())
+	{
+		Cam->ClearPoseLayer(ECameraLayer::Sequence);
+		Cam->ClearOffsetLayer(ECameraOffset::SequenceBreath);
+	}
+
 	// Reset round counter and permanently removed modifiers for new game
 	CurrentRound = 1;
 	PermanentlyRemovedModifiers.Empty();
@@ -760,6 +888,13 @@ void ADiceGameManager::StartGame()
 
 void ADiceGameManager::EnemyThrowDice()
 {
+	// Every round starts with the enemy throw
+	ReportRoundPacing();
+	PacingRound++;
+	PacingRoundStartTime = FPlatformTime::Seconds();
+	PacingDeadWait = 0.0f;
+	PacingTransitions = 0;
+
 	// Set timer to DEALING state
 	URoundTimerComponent* Timer = GetRoundTimer();
 	if (Timer)
@@ -767,86 +902,188 @@ void ADiceGameManager::EnemyThrowDice()
 		Timer->SetDealing();
 	}
 
+	if (!FindEnemy())
+	{
+		DiscardStagedRound();
+		return;
+	}
+
+	// Use what was staged during the chop, finishing anything it didn't have time for
+	int32 NumStagedAhead = StagedEnemyDice.Num();
+	if (StagedEnemyThrows.Num() != EnemyNumDice)
+	{
+		DiscardStagedRound();
+		NumStagedAhead = 0;
+		DrawEnemyThrows(StagedEnemyThrows);
+	}
+	while (StagedEnemyDice.Num() < StagedEnemyThrows.Num())
+	{
+		StageNextEnemyDice();
+	}
+	bStagingNextRound = false;
+
+	UE_LOG(LogDiceGame, Verbose, TEXT("EnemyThrowDice - %d/%d dice staged ahead of the throw"), NumStagedAhead, StagedEnemyThrows.Num());
+
+	for (int32 i = 0; i < StagedEnemyDice.Num(); i++)
+	{
+		ADice* NewDice = StagedEnemyDice[i];
+		if (!NewDice || !IsValid(NewDice)) continue;
+
+		// Wake it up where it was staged and throw
+		NewDice->bShowDebugNumbers = bShowDebugGizmos;
+		NewDice->SetActorHiddenInGame(false);
+		NewDice->SetActorEnableCollision(true);
+		NewDice->SetActorTickEnabled(true);
+		NewDice->Mesh->SetSimulatePhysics(true);
+
+		NewDice->Throw(StagedEnemyThrows[i].ThrowDirection, DiceThrowForce);
+		EnemyDice.Add(NewDice);
+	}
+	StagedEnemyDice.Empty();
+	StagedEnemyThrows.Empty();
+
+	ArmEnemySettleGate();
+	CurrentPhase = EGamePhase::EnemyDiceSettling;
+}
+
+// ==================== NEXT ROUND STAGING ====================
+
+void ADiceGameManager::DrawEnemyThrows(TArray<FStagedDiceThrow>& OutThrows)
+{
+	OutThrows.Empty();
+
 	AMaskEnemy* Enemy = FindEnemy();
 	if (!Enemy) return;
 
-	FVector EnemyLocation = Enemy->GetActorLocation();
-	FVector SpawnBase = EnemyLocation + EnemyDiceSpawnOffset;
+	FVector SpawnBase = Enemy->GetActorLocation() + EnemyDiceSpawnOffset;
 	FVector ThrowTarget = GetLineupWorldCenter();
 
 	for (int32 i = 0; i < EnemyNumDice; i++)
 	{
+		FStagedDiceThrow& Throw = OutThrows.AddDefaulted_GetRef();
+
 		FVector SpawnOffset = FVector(
 			FMath::RandRange(-15.0f, 15.0f),
 			(i - EnemyNumDice / 2.0f) * 20.0f,
 			FMath::RandRange(0.0f, 10.0f)
 		);
 
-		FVector SpawnLocation = SpawnBase + SpawnOffset;
-		FRotator SpawnRotation = FRotator(
+		Throw.SpawnLocation = SpawnBase + SpawnOffset;
+		Throw.SpawnRotation = FRotator(
 			FMath::RandRange(0.0f, 360.0f),
 			FMath::RandRange(0.0f, 360.0f),
 			FMath::RandRange(0.0f, 360.0f)
 		);
 
-		FActorSpawnParameters Params;
-		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		Throw.ThrowDirection = (ThrowTarget - Throw.SpawnLocation).GetSafeNormal();
+		Throw.ThrowDirection += FVector(
+			FMath::RandRange(-0.15f, 0.15f),
+			FMath::RandRange(-0.15f, 0.15f),
+			FMath::RandRange(-0.1f, 0.0f)
+		);
+	}
+}
 
-		ADice* NewDice = GetWorld()->SpawnActor<ADice>(ADice::StaticClass(), SpawnLocation, SpawnRotation, Params);
-		if (NewDice)
-		{
-			NewDice->bShowDebugNumbers = bShowDebugGizmos;
-			NewDice->DiceSize = DiceScale;
+void ADiceGameManager::StageNextEnemyDice()
+{
+	const FStagedDiceThrow& Throw = StagedEnemyThrows[StagedEnemyDice.Num()];
 
-			// Apply enemy dice visuals (use PlayerDiceMesh if no EnemyDiceMesh set)
-			UStaticMesh* MeshToUse = EnemyDiceMesh ? EnemyDiceMesh : PlayerDiceMesh;
-			if (MeshToUse)
-			{
-				NewDice->SetCustomMesh(MeshToUse, CustomMeshScale);
-			}
-			if (EnemyDiceMaterial)
-			{
-				NewDice->SetCustomMaterial(EnemyDiceMaterial);
-			}
-			NewDice->SetTextColor(EnemyTextColor);
-			NewDice->SetFaceNumbersVisible(bShowDiceNumbers);
-			NewDice->SetTextSettings(DiceTextSize, DiceTextOffset);
-			NewDice->DiceSize = DiceScale;
-			// Scale is handled in Dice::Tick with MeshNormalizeScale
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-			FVector ThrowDirection = (ThrowTarget - SpawnLocation).GetSafeNormal();
-			ThrowDirection += FVector(
-				FMath::RandRange(-0.15f, 0.15f),
-				FMath::RandRange(-0.15f, 0.15f),
-				FMath::RandRange(-0.1f, 0.0f)
-			);
+	ADice* NewDice = GetWorld()->SpawnActor<ADice>(ADice::StaticClass(), Throw.SpawnLocation, Throw.SpawnRotation, Params);
+	if (NewDice)
+	{
+		NewDice->bShowDebugNumbers = bShowDebugGizmos;
+		NewDice->DiceSize = DiceScale;
 
-			NewDice->Throw(ThrowDirection, DiceThrowForce);
-			EnemyDice.Add(NewDice);
+		// Apply enemy dice visuals (use PlayerDiceMesh if no EnemyDiceMesh set)
+		UStaticMesh* MeshToUse = EnemyDiceMesh ? EnemyDiceMesh : PlayerDiceMesh;
+		if (MeshToUse)
+		{
+			NewDice->SetCustomMesh(MeshToUse, CustomMeshScale);
+		}
+		if (EnemyDiceMaterial)
+		{
+			NewDice->SetCustomMaterial(EnemyDiceMaterial);
 		}
+		NewDice->SetTextColor(EnemyTextColor);
+		NewDice->SetFaceNumbersVisible(bShowDiceNumbers);
+		NewDice->SetTextSettings(DiceTextSize, DiceTextOffset);
+		// Scale is handled in Dice::Tick with MeshNormalizeScale
+
+		// Park it hidden until the throw
+		NewDice->Mesh->SetSimulatePhysics(false);
+		NewDice->SetActorEnableCollision(false);
+		NewDice->SetActorHiddenInGame(true);
+		NewDice->SetActorTickEnabled(false);
 	}
 
-	bEnemyDiceSettled = false;
-	WaitTimer = 0.0f;
-	CurrentPhase = EGamePhase::EnemyDiceSettling;
+	// Keep slots lined up with StagedEnemyThrows even if the spawn failed
+	StagedEnemyDice.Add(NewDice);
+}
+
+void ADiceGameManager::StageNextRound()
+{
+	DiscardStagedRound();
+
+	DrawEnemyThrows(StagedEnemyThrows);
+
+	TArray<ADiceModifier*> AvailableModifiers;
+	GetShuffleableModifiers(AvailableModifiers);
+	BuildModifierShufflePlan(AvailableModifiers, CurrentRound + 1, ModifierShufflePlan);
+
+	bStagingNextRound = StagedEnemyThrows.Num() > 0;
+}
+
+void ADiceGameManager::UpdateNextRoundStaging()
+{
+	// One die per frame keeps the spawn cost off any single frame of the chop
+	if (StagedEnemyDice.Num() < StagedEnemyThrows.Num())
+	{
+		StageNextEnemyDice();
+	}
+
+	if (StagedEnemyDice.Num() >= StagedEnemyThrows.Num())
+	{
+		bStagingNextRound = false;
+	}
+}
+
+void ADiceGameManager::DiscardStagedRound()
+{
+	for (ADice* D : StagedEnemyDice)
+	{
+		if (D && IsValid(D))
+		{
+			D->Destroy();
+		}
+	}
+	StagedEnemyDice.Empty();
+	StagedEnemyThrows.Empty();
+	ModifierShufflePlan = FModifierShufflePlan();
+	bStagingNextRound = false;
 }
 
 void ADiceGameManager::CheckEnemyDiceSettled(float DeltaTime)
 {
 	bool AllSettled = true;
+	bool AllAsleep = true;
 	for (ADice* D : EnemyDice)
 	{
 		if (D)
 		{
+			if (!D->IsAsleep()) AllAsleep = false;
+
 			if (D->IsStill())
 			{
-				// Play sound for this dice if it just landed
-				if (!D->bHasPlayedLandSound)
+				// Landing sounds come from the die's own hits - this only announces the result
+				if (!D->bHasReportedSettle)
 				{
-					D->bHasPlayedLandSound = true;
-					if (SoundManager)
+					D->bHasReportedSettle = true;
+					if (EventBus)
 					{
-						SoundManager->PlayDiceRollAtLocation(D->GetActorLocation());
+						EventBus->Publish(FDiceSettledEvent{ D, D->GetResult(), true });
 					}
 				}
 			}
@@ -859,21 +1096,28 @@ void ADiceGameManager::CheckEnemyDiceSettled(float DeltaTime)
 
 	if (AllSettled && EnemyDice.Num() > 0)
 	{
+		double Now = GetWorld()->GetTimeSeconds();
 		if (!bEnemyDiceSettled)
 		{
 			bEnemyDiceSettled = true;
-			WaitTimer = 0.0f;
+			DiceStillSinceTime = Now;
 		}
 
-		WaitTimer += DeltaTime;
-
-		if (WaitTimer >= 1.5f)
+		if (IsLegacyPacing())
 		{
-			PrepareEnemyDiceLineup();
-			LineupProgress = 0.0f;
-			CurrentPhase = EGamePhase::EnemyDiceLining;
+			SignalPhaseGate(EPhaseGate::EnemyDiceSettled, 1.5f);
+		}
+		else if (AllAsleep || Now - DiceStillSinceTime >= SettleConfirmTime)
+		{
+			SignalPhaseGate(EPhaseGate::EnemyDiceSettled);
 		}
 	}
+	else if (bEnemyDiceSettled)
+	{
+		// A die got knocked - wait for everything to be still again
+		bEnemyDiceSettled = false;
+		UnsignalPhaseGate(EPhaseGate::EnemyDiceSettled);
+	}
 }
 
 void ADiceGameManager::PrepareEnemyDiceLineup()
@@ -1060,8 +1304,7 @@ void ADiceGameManager::PlayerThrowDice()
 		}
 	}
 
-	bPlayerDiceSettled = false;
-	WaitTimer = 0.0f;
+	ArmPlayerSettleGate();
 	CurrentPhase = EGamePhase::PlayerDiceSettling;
 }
 
@@ -1069,6 +1312,7 @@ void ADiceGameManager::CheckPlayerDiceSettled()
 {
 	// Only check dice that are currently being thrown (have physics enabled)
 	bool AllSettled = true;
+	bool AllAsleep = true;
 	for (int32 i = 0; i < PlayerDice.Num(); i++)
 	{
 		ADice* D = PlayerDice[i];
@@ -1078,15 +1322,17 @@ void ADiceGameManager::CheckPlayerDiceSettled()
 		if (PlayerDiceMatched.IsValidIndex(i) && PlayerDiceMatched[i]) continue;
 		if (PlayerDiceModified.IsValidIndex(i) && PlayerDiceModified[i]) continue;
 
+		if (!D->IsAsleep()) AllAsleep = false;
+
 		if (D->IsStill())
 		{
-			// Play sound for this dice if it just landed
-			if (!D->bHasPlayedLandSound)
+			// Landing sounds come from the die's own hits - this only announces the result
+			if (!D->bHasReportedSettle)
 			{
-				D->bHasPlayedLandSound = true;
-				if (SoundManager)
+				D->bHasReportedSettle = true;
+				if (EventBus)
 				{
-					SoundManager->PlayDiceRollAtLocation(D->GetActorLocation());
+					EventBus->Publish(FDiceSettledEvent{ D, D->GetResult(), false });
 				}
 			}
 		}
@@ -1098,27 +1344,29 @@ void ADiceGameManager::CheckPlayerDiceSettled()
 
 	if (AllSettled && PlayerDice.Num() > 0)
 	{
+		double Now = GetWorld()->GetTimeSeconds();
 		if (!bPlayerDiceSettled)
 		{
 			bPlayerDiceSettled = true;
-			WaitTimer = 0.0f;
+			DiceStillSinceTime = Now;
 		}
 
-		WaitTimer += GetWorld()->GetDeltaSeconds();
-
-		// Shorter wait for rerolls during matching phase
-		float WaitTime = (PlayerDiceMatched.Num() > 0) ? 0.8f : 1.5f;
-
-		if (WaitTimer >= WaitTime)
+		if (IsLegacyPacing())
 		{
-			// Check if we're coming from a reroll during matching phase
-			bool bWasReroll = (PlayerDiceMatched.Num() > 0);
-
-			PreparePlayerDiceLineup();
-			PlayerLineupProgress = 0.0f;
-			CurrentPhase = EGamePhase::PlayerDiceLining;
+			// Shorter wait for rerolls during matching phase
+			SignalPhaseGate(EPhaseGate::PlayerDiceSettled, (PlayerDiceMatched.Num() > 0) ? 0.8f : 1.5f);
+		}
+		else if (AllAsleep || Now - DiceStillSinceTime >= SettleConfirmTime)
+		{
+			SignalPhaseGate(EPhaseGate::PlayerDiceSettled);
 		}
 	}
+	else if (bPlayerDiceSettled)
+	{
+		// A die got knocked - wait for everything to be still again
+		bPlayerDiceSettled = false;
+		UnsignalPhaseGate(EPhaseGate::PlayerDiceSettled);
+	}
 }
 
 void ADiceGameManager::PreparePlayerDiceLineup()
@@ -1263,12 +1511,13 @@ void ADiceGameManager::LineUpPlayerDice(float DeltaTime)
 
 void ADiceGameManager::StartMatchingPhase()
 {
-	UE_LOG(LogTemp, Warning, TEXT("StartMatchingPhase - CurrentRound: %d"), CurrentRound);
+	UE_LOG(LogDiceGame, Log, TEXT("StartMatchingPhase - CurrentRound: %d"), CurrentRound);
 
 	CurrentPhase = EGamePhase::PlayerMatching;
 	SelectionMode = 0;
 	SelectedDiceIndex = 0;
 	LastHoveredDice = nullptr;
+	QueuedInputs.Empty();
 
 	for (int32 i = 0; i < PlayerDiceMatched.Num(); i++)
 	{
@@ -1307,6 +1556,7 @@ void ADiceGameManager::TryMatchDice(int32 PlayerIndex, int32 EnemyIndex)
 {
 	if (!PlayerDice.IsValidIndex(PlayerIndex) || !EnemyDice.IsValidIndex(EnemyIndex)) return;
 	if (PlayerDiceMatched[PlayerIndex] || EnemyDiceMatched[EnemyIndex]) return;
+	if (IsEnemyDiceClaimed(EnemyIndex)) return;  // Another die is already flying onto it
 
 	int32 PlayerVal = PlayerResults[PlayerIndex];
 	int32 EnemyVal = EnemyResults[EnemyIndex];
@@ -1336,43 +1586,37 @@ void ADiceGameManager::StartMatchAnimation(int32 PlayerIdx, int32 EnemyIdx)
 		SoundManager->PlayDiceMatch();
 	}
 
-	bMatchAnimating = true;
-	MatchPlayerIndex = PlayerIdx;
-	MatchEnemyIndex = EnemyIdx;
-	MatchAnimProgress = 0.0f;
+	MatchingActionCount++;
 
-	MatchStartPos = PlayerDice[PlayerIdx]->GetActorLocation();
+	FPlayerDiceAnim& Anim = StartDiceAnim(PlayerIdx, EDiceAnim::Match);
+	Anim.EnemyIndex = EnemyIdx;
+	Anim.StartPos = PlayerDice[PlayerIdx]->GetActorLocation();
 	// Target is next to enemy dice
-	MatchTargetPos = EnemyDice[EnemyIdx]->GetActorLocation();
-	MatchTargetPos.Z = MatchStartPos.Z;  // Same height
+	Anim.TargetPos = EnemyDice[EnemyIdx]->GetActorLocation();
+	Anim.TargetPos.Z = Anim.StartPos.Z;  // Same height
 }
 
-void ADiceGameManager::UpdateMatchAnimation(float DeltaTime)
+void ADiceGameManager::UpdateMatchAnimation(int32 DiceIndex, float DeltaTime)
 {
-	if (!bMatchAnimating) return;
-
-	if (!PlayerDice.IsValidIndex(MatchPlayerIndex) || !EnemyDice.IsValidIndex(MatchEnemyIndex))
-	{
-		bMatchAnimating = false;
-		return;
-	}
+	FPlayerDiceAnim& Anim = PlayerDiceAnims[DiceIndex];
+	const int32 EnemyIndex = Anim.EnemyIndex;
 
-	ADice* PlayerD = PlayerDice[MatchPlayerIndex];
-	ADice* EnemyD = EnemyDice[MatchEnemyIndex];
+	ADice* PlayerD = PlayerDice.IsValidIndex(DiceIndex) ? PlayerDice[DiceIndex] : nullptr;
+	ADice* EnemyD = EnemyDice.IsValidIndex(EnemyIndex) ? EnemyDice[EnemyIndex] : nullptr;
 	if (!PlayerD || !EnemyD)
 	{
-		bMatchAnimating = false;
+		Anim.Type = EDiceAnim::None;
 		return;
 	}
 
-	MatchAnimProgress += DeltaTime * 4.0f;
-	float Alpha = FMath::Clamp(MatchAnimProgress, 0.0f, 1.0f);
+	Anim.Progress += DeltaTime * 4.0f;
+	float Alpha = FMath::Clamp(Anim.Progress, 0.0f, 1.0f);
 
 	// Juicy ease
 	float SmoothAlpha = EaseOutCubic(Alpha);
 
 	// Player dice flies to enemy dice with arc
-	FVector NewPos = FMath::Lerp(MatchStartPos, MatchTargetPos, SmoothAlpha);
+	FVector NewPos = FMath::Lerp(Anim.StartPos, Anim.TargetPos, SmoothAlpha);
 	float ArcHeight = FMath::Sin(Alpha * PI) * 20.0f;
 	NewPos.Z += ArcHeight;
 	PlayerD->SetActorLocation(NewPos);
@@ -1382,15 +1626,22 @@ void ADiceGameManager::UpdateMatchAnimation(float DeltaTime)
 	PlayerD->Mesh->SetWorldScale3D(FVector(PlayerD->DiceSize * PlayerD->MeshNormalizeScale * ScalePop));
 	EnemyD->Mesh->SetWorldScale3D(FVector(EnemyD->DiceSize * EnemyD->MeshNormalizeScale * ScalePop));
 
-	if (MatchAnimProgress >= 1.0f)
+	if (Anim.Progress >= 1.0f)
 	{
+		Anim.Type = EDiceAnim::None;
+
 		// Animation complete - finalize match
-		PlayerDiceMatched[MatchPlayerIndex] = true;
-		EnemyDiceMatched[MatchEnemyIndex] = true;
+		PlayerDiceMatched[DiceIndex] = true;
+		EnemyDiceMatched[EnemyIndex] = true;
 
 		PlayerD->SetMatched(true);
 		EnemyD->SetMatched(true);
 
+		if (EventBus)
+		{
+			EventBus->Publish(FDiceMatchEvent{ PlayerD, EnemyD, PlayerD->GetResult() });
+		}
+
 		// Stack them together
 		FVector FinalPos = EnemyD->GetActorLocation();
 		FinalPos.Z += 8.0f;  // Stack on top
@@ -1414,10 +1665,7 @@ void ADiceGameManager::UpdateMatchAnimation(float DeltaTime)
 			PC->SetControlRotation(PC->GetControlRotation() + Shake);
 		}
 
-		bMatchAnimating = false;
-		MatchPlayerIndex = -1;
-		MatchEnemyIndex = -1;
-
+		// May end the round and clear every die - must be last
 		CheckAllMatched();
 	}
 }
@@ -1429,56 +1677,56 @@ void ADiceGameManager::TryApplyModifier(ADiceModifier* Modifier, int32 DiceIndex
 	if (PlayerDiceMatched[DiceIndex]) return;
 	// REMOVED: PlayerDiceModified check - allow modifier combos!
 
+	const FDiceModifierRow& Row = Modifier->GetRow();
 	int32 OldValue = PlayerResults[DiceIndex];
-	int32 NewValue = Modifier->ApplyToValue(OldValue);
 
-	// Check if modifier would have no effect or result in invalid value
-	if (Modifier->ModifierType == EModifierType::MinusOne && OldValue <= 1)
-	{
-		// Can't go below 1 - reject
-		if (SoundManager) SoundManager->PlayError();
-		return;
-	}
-	if (Modifier->ModifierType == EModifierType::PlusOne && OldValue >= 6)
-	{
-		// Can't go above 6 - reject
-		if (SoundManager) SoundManager->PlayError();
-		return;
-	}
-	if (Modifier->ModifierType == EModifierType::PlusTwo && OldValue >= 5)
+	// Reject faces the modifier can't be used on (e.g. -1 on a 1, +2 on a 5)
+	if (!Row.CanApply(OldValue))
 	{
-		// Can't go above 6 - reject (5+2=7, 6+2=8 are invalid)
 		if (SoundManager) SoundManager->PlayError();
 		return;
 	}
+	int32 NewValue = Row.Results[OldValue];
+
+	MatchingActionCount++;
 
 	// Handle RE:1 - snap to modifier then throw
-	if (Modifier->ModifierType == EModifierType::RerollOne)
+	if (Row.Reroll == EModifierReroll::One)
 	{
 		PlayerDiceModified[DiceIndex] = true;
 		PlayerDiceAtModifier[DiceIndex] = Modifier;
-		bRerollAfterSnap = true;
-		bRerollAll = false;
-		RerollDiceIndex = DiceIndex;
-		SnapDiceToModifier(DiceIndex, Modifier);
+		SnapDiceToModifier(DiceIndex, Modifier, true);
 		Modifier->UseModifier();
 		return;
 	}
 
 	// Handle RE:ALL - reset camera first, then throw all
-	if (Modifier->ModifierType == EModifierType::RerollAll)
+	if (Row.Reroll == EModifierReroll::All)
 	{
-		// Start camera reset, wait, then throw
+		// Start camera reset and lift the dice while it moves - the throw waits for the camera
 		bWaitingForCameraToRerollAll = true;
-		RerollAllWaitTimer = 0.0f;
 		DeactivateModifiers();
 		ResetCamera();
 		Modifier->UseModifier();
+
+		// Lift only once every die has finished what it was doing
+		RunWhenDiceAnimsIdle([this]()
+		{
+			if (IsLegacyPacing())
+			{
+				ArmPhaseGate(EPhaseGate::RerollAllStart, 0.6f, [this]() { StartDiceLiftForReroll(); });
+				SignalPhaseGate(EPhaseGate::RerollAllStart);
+			}
+			else
+			{
+				StartDiceLiftForReroll();
+			}
+		});
 		return;
 	}
 
 	// Handle FLIP - juicy flip animation
-	if (Modifier->ModifierType == EModifierType::Flip)
+	if (Row.bFlip)
 	{
 		PlayerResults[DiceIndex] = NewValue;
 		PlayerDice[DiceIndex]->CurrentValue = NewValue;
@@ -1490,7 +1738,7 @@ void ADiceGameManager::TryApplyModifier(ADiceModifier* Modifier, int32 DiceIndex
 		return;
 	}
 
-	// Handle +1, -1, +2 - snap and rotate to new value
+	// Handle +1, -1, +2 and any other value transform - snap and rotate to new value
 	PlayerResults[DiceIndex] = NewValue;
 	PlayerDice[DiceIndex]->CurrentValue = NewValue;
 	PlayerDiceModified[DiceIndex] = true;
@@ -1510,7 +1758,7 @@ void ADiceGameManager::UpdateDiceFaceDisplay(ADice* Dice, int32 NewValue)
 	Dice->SetActorRotation(NewRot);
 }
 
-void ADiceGameManager::SnapDiceToModifier(int32 DiceIndex, ADiceModifier* Modifier)
+void ADiceGameManager::SnapDiceToModifier(int32 DiceIndex, ADiceModifier* Modifier, bool bRerollAfter)
 {
 	if (!Modifier || !PlayerDice.IsValidIndex(DiceIndex)) return;
 
@@ -1518,80 +1766,70 @@ void ADiceGameManager::SnapDiceToModifier(int32 DiceIndex, ADiceModifier* Modifi
 	if (!Dice) return;
 
 	// Start snap animation
-	bDiceSnappingToModifier = true;
-	SnapTargetModifier = Modifier;
-	SnapDiceIndex = DiceIndex;
-	ReturnProgress = 0.0f;
-	ReturnStartPos = Dice->GetActorLocation();
-	ReturnStartRot = Dice->GetActorRotation();
+	FPlayerDiceAnim& Anim = StartDiceAnim(DiceIndex, EDiceAnim::Snap);
+	Anim.Modifier = Modifier;
+	Anim.bRerollAfter = bRerollAfter;
+	Anim.StartPos = Dice->GetActorLocation();
+	Anim.StartRot = Dice->GetActorRotation();
 
 	// Target position is above the modifier
-	ReturnTargetPos = Modifier->GetActorLocation() + FVector(0, 0, 20.0f);
-	ReturnTargetRot = GetRotationForFaceUp(PlayerResults[DiceIndex]);
-	ReturnTargetRot.Yaw += LineupYaw;
+	Anim.TargetPos = Modifier->GetActorLocation() + FVector(0, 0, 20.0f);
+	Anim.TargetRot = GetRotationForFaceUp(PlayerResults[DiceIndex]);
+	Anim.TargetRot.Yaw += LineupYaw;
 }
 
-void ADiceGameManager::UpdateModifierSnap(float DeltaTime)
+void ADiceGameManager::UpdateModifierSnap(int32 DiceIndex, float DeltaTime)
 {
-	if (!bDiceSnappingToModifier) return;
-	if (!PlayerDice.IsValidIndex(SnapDiceIndex))
-	{
-		bDiceSnappingToModifier = false;
-		return;
-	}
+	FPlayerDiceAnim& Anim = PlayerDiceAnims[DiceIndex];
 
-	ADice* Dice = PlayerDice[SnapDiceIndex];
+	ADice* Dice = PlayerDice.IsValidIndex(DiceIndex) ? PlayerDice[DiceIndex] : nullptr;
 	if (!Dice)
 	{
-		bDiceSnappingToModifier = false;
+		Anim.Type = EDiceAnim::None;
 		return;
 	}
 
-	ReturnProgress += DeltaTime * 5.0f;  // Faster snap
-	float Alpha = FMath::Clamp(ReturnProgress, 0.0f, 1.0f);
+	Anim.Progress += DeltaTime * 5.0f;  // Faster snap
+	float Alpha = FMath::Clamp(Anim.Progress, 0.0f, 1.0f);
 
 	// Smooth easing
 	float SmoothAlpha = EaseOutCubic(Alpha);
 
 	// Lerp position only during snap (rotation happens after for FLIP)
-	FVector NewPos = FMath::Lerp(ReturnStartPos, ReturnTargetPos, SmoothAlpha);
+	FVector NewPos = FMath::Lerp(Anim.StartPos, Anim.TargetPos, SmoothAlpha);
 	Dice->SetActorLocation(NewPos);
 
 	// Check if this is a FLIP modifier - don't rotate during snap
-	bool bIsFlip = (SnapTargetModifier && SnapTargetModifier->ModifierType == EModifierType::Flip);
+	bool bIsFlip = (Anim.Modifier && Anim.Modifier->GetRow().bFlip);
 	if (!bIsFlip)
 	{
-		FRotator NewRot = FMath::Lerp(ReturnStartRot, ReturnTargetRot, SmoothAlpha);
+		FRotator NewRot = FMath::Lerp(Anim.StartRot, Anim.TargetRot, SmoothAlpha);
 		Dice->SetActorRotation(NewRot);
 	}
 
-	if (ReturnProgress >= 1.0f)
+	if (Anim.Progress >= 1.0f)
 	{
-		Dice->SetActorLocation(ReturnTargetPos);
-
-		int32 CompletedIndex = SnapDiceIndex;
-		ADiceModifier* CompletedModifier = SnapTargetModifier;
+		Dice->SetActorLocation(Anim.TargetPos);
 
-		bDiceSnappingToModifier = false;
-		SnapTargetModifier = nullptr;
-		SnapDiceIndex = -1;
+		FRotator FinalRot = Anim.TargetRot;
+		bool bRerollAfter = Anim.bRerollAfter;
+		Anim.Type = EDiceAnim::None;
 
 		// After snap completes, handle special effects
-		if (bRerollAfterSnap && !bRerollAll && RerollDiceIndex == CompletedIndex)
+		if (bRerollAfter)
 		{
-			// RE:1 - now throw this dice
-			bRerollAfterSnap = false;
-			RerollSingleDice(CompletedIndex);
+			// RE:1 - throw this dice once nothing else is mid-animation
+			RunWhenDiceAnimsIdle([this, DiceIndex]() { RerollSingleDice(DiceIndex); });
 		}
 		else if (bIsFlip)
 		{
 			// FLIP - start juicy flip animation
-			StartDiceFlip(CompletedIndex, PlayerResults[CompletedIndex]);
+			StartDiceFlip(DiceIndex, PlayerResults[DiceIndex]);
 		}
 		else
 		{
 			// +1/-1/+2 - set final rotation
-			Dice->SetActorRotation(ReturnTargetRot);
+			Dice->SetActorRotation(FinalRot);
 		}
 	}
 }
@@ -1603,56 +1841,48 @@ void ADiceGameManager::StartDiceFlip(int32 DiceIndex, int32 NewValue)
 	ADice* Dice = PlayerDice[DiceIndex];
 	if (!Dice) return;
 
-	bDiceFlipping = true;
-	FlipDiceIndex = DiceIndex;
-	FlipProgress = 0.0f;
-	FlipStartRot = Dice->GetActorRotation();
+	FPlayerDiceAnim& Anim = StartDiceAnim(DiceIndex, EDiceAnim::Flip);
+	Anim.StartPos = Dice->GetActorLocation();  // Resting spot above the modifier
+	Anim.StartRot = Dice->GetActorRotation();
 
 	// Target rotation shows the new (flipped) value
-	FlipTargetRot = GetRotationForFaceUp(NewValue);
-	FlipTargetRot.Yaw += LineupYaw;
+	Anim.TargetRot = GetRotationForFaceUp(NewValue);
+	Anim.TargetRot.Yaw += LineupYaw;
 }
 
-void ADiceGameManager::UpdateDiceFlip(float DeltaTime)
+void ADiceGameManager::UpdateDiceFlip(int32 DiceIndex, float DeltaTime)
 {
-	if (!bDiceFlipping) return;
-	if (!PlayerDice.IsValidIndex(FlipDiceIndex))
-	{
-		bDiceFlipping = false;
-		return;
-	}
+	FPlayerDiceAnim& Anim = PlayerDiceAnims[DiceIndex];
 
-	ADice* Dice = PlayerDice[FlipDiceIndex];
+	ADice* Dice = PlayerDice.IsValidIndex(DiceIndex) ? PlayerDice[DiceIndex] : nullptr;
 	if (!Dice)
 	{
-		bDiceFlipping = false;
+		Anim.Type = EDiceAnim::None;
 		return;
 	}
 
-	FlipProgress += DeltaTime * 2.5f;  // Juicy speed
-	float Alpha = FMath::Clamp(FlipProgress, 0.0f, 1.0f);
+	Anim.Progress += DeltaTime * 2.5f;  // Juicy speed
+	float Alpha = FMath::Clamp(Anim.Progress, 0.0f, 1.0f);
 
 	// Juicy flip - overshoot then settle
 	float FlipAlpha = EaseOutElastic(Alpha);
 
 	// Add a hop during flip
-	FVector BasePos = Dice->GetActorLocation();
 	float HopHeight = FMath::Sin(Alpha * PI) * 15.0f;
-	Dice->SetActorLocation(FVector(BasePos.X, BasePos.Y, PlayerDiceAtModifier[FlipDiceIndex]->GetActorLocation().Z + 20.0f + HopHeight));
+	Dice->SetActorLocation(Anim.StartPos + FVector(0, 0, HopHeight));
 
 	// Rotate with extra spin for juice
-	FRotator CurrentRot = FMath::Lerp(FlipStartRot, FlipTargetRot, FlipAlpha);
+	FRotator CurrentRot = FMath::Lerp(Anim.StartRot, Anim.TargetRot, FlipAlpha);
 	// Add extra roll wobble
 	CurrentRot.Roll += FMath::Sin(Alpha * PI * 3.0f) * (1.0f - Alpha) * 15.0f;
 	Dice->SetActorRotation(CurrentRot);
 
-	if (FlipProgress >= 1.0f)
+	if (Anim.Progress >= 1.0f)
 	{
 		// Final position and rotation
-		Dice->SetActorLocation(FVector(BasePos.X, BasePos.Y, PlayerDiceAtModifier[FlipDiceIndex]->GetActorLocation().Z + 20.0f));
-		Dice->SetActorRotation(FlipTargetRot);
-		bDiceFlipping = false;
-		FlipDiceIndex = -1;
+		Dice->SetActorLocation(Anim.StartPos);
+		Dice->SetActorRotation(Anim.TargetRot);
+		Anim.Type = EDiceAnim::None;
 	}
 }
 
@@ -1700,12 +1930,11 @@ void ADiceGameManager::RerollSingleDice(int32 DiceIndex)
 
 	Dice->Throw(ThrowDir, DiceThrowForce * 0.6f);
 
-	// Skip landing sound since we already played on throw
-	Dice->bHasPlayedLandSound = true;
+	// Rerolled dice don't announce settling again
+	Dice->bHasReportedSettle = true;
 
 	// Mark that we need to wait for this dice to settle
-	bPlayerDiceSettled = false;
-	WaitTimer = 0.0f;
+	ArmPlayerSettleGate();
 
 	// Go back to settling phase
 	CurrentPhase = EGamePhase::PlayerDiceSettling;
@@ -1779,11 +2008,27 @@ void ADiceGameManager::UpdateDiceLiftForReroll(float DeltaTime)
 		}
 	}
 
-	// When lift is done, throw them down
-	if (DiceLiftProgress >= 1.0f)
+	// When lift is done, throw them down (holding the lift until the camera is back)
+	if (DiceLiftProgress >= 1.0f && !bRerollThrowQueued)
 	{
-		bDiceLiftingForReroll = false;
-		RerollAllUnmatchedDice();
+		bRerollThrowQueued = true;
+
+		auto ThrowLifted = [this]()
+		{
+			bDiceLiftingForReroll = false;
+			bWaitingForCameraToRerollAll = false;
+			bRerollThrowQueued = false;
+			RerollAllUnmatchedDice();
+		};
+
+		if (IsLegacyPacing())
+		{
+			ThrowLifted();
+		}
+		else
+		{
+			RunAfterCameraPan(MoveTemp(ThrowLifted));
+		}
 	}
 }
 
@@ -1832,8 +2077,8 @@ void ADiceGameManager::RerollAllUnmatchedDice()
 
 		Dice->Throw(ThrowDir, DiceThrowForce);
 
-		// Skip landing sound since we already played on throw
-		Dice->bHasPlayedLandSound = true;
+		// Rerolled dice don't announce settling again
+		Dice->bHasReportedSettle = true;
 
 		bAnyRerolled = true;
 	}
@@ -1841,10 +2086,7 @@ void ADiceGameManager::RerollAllUnmatchedDice()
 	if (bAnyRerolled)
 	{
 		// Go back to settling phase to wait for dice
-		bPlayerDiceSettled = false;
-		WaitTimer = 0.0f;
-		bRerollAfterSnap = false;
-		bRerollAll = false;
+		ArmPlayerSettleGate();
 		CurrentPhase = EGamePhase::PlayerDiceSettling;
 	}
 }
@@ -1859,6 +2101,8 @@ void ADiceGameManager::CheckAllMatched()
 
 	if (MatchCount >= EnemyDice.Num())
 	{
+		ReportMatchingThroughput();
+
 		// Hide the fold prompt
 		StartDiceLabelTypewriterOut();
 
@@ -1882,12 +2126,14 @@ void ADiceGameManager::CheckAllMatched()
 		EnemyDiceMatched.Empty();
 		PlayerDiceModified.Empty();
 		PlayerDiceAtModifier.Empty();
-		WaitTimer = 0.0f;
+		ResetDiceAnims();
+		CancelPhaseGate(EPhaseGate::EnemyDiceSettled);
+		CancelPhaseGate(EPhaseGate::PlayerDiceSettled);
 		SelectionMode = 0;
 		SelectedDiceIndex = -1;
 
-		// Wait for camera to finish panning, then chop enemy finger
-		bWaitingForCameraThenEnemyChop = true;
+		// Chop enemy finger as soon as the camera is back
+		RunAfterCameraPan([this]() { TriggerEnemyChop(); });
 	}
 }
 
@@ -1923,51 +2169,59 @@ void ADiceGameManager::ClearAllDice()
 
 void ADiceGameManager::StartDiceDisperse()
 {
+	for (FDiceBallisticHandle& Body : DisperseBodies)
+	{
+		Ballistics.Remove(Body);
+	}
 	DispersingDice.Empty();
-	DisperseStartPositions.Empty();
-	DisperseVelocities.Empty();
-	DisperseStartScales.Empty();
+	DisperseBodies.Empty();
 
 	// Gather all dice for dispersing
 	FVector Center = GetLineupWorldCenter();
 
-	for (ADice* D : EnemyDice)
+	TArray<ADice*, TInlineAllocator<16>> ToDisperse;
+	ToDisperse.Append(EnemyDice);
+	ToDisperse.Append(PlayerDice);
+
+	for (ADice* D : ToDisperse)
 	{
 		if (D && IsValid(D))
 		{
-			DispersingDice.Add(D);
-			DisperseStartPositions.Add(D->GetActorLocation());
-			DisperseStartScales.Add(D->DiceSize * D->MeshNormalizeScale);
-
 			// Random outward velocity with upward arc
 			FVector ToCenter = (D->GetActorLocation() - Center).GetSafeNormal();
 			FVector Velocity = ToCenter * FMath::RandRange(150.0f, 300.0f);
 			Velocity.Z = FMath::RandRange(100.0f, 200.0f);
 			Velocity += FVector(FMath::RandRange(-50.0f, 50.0f), FMath::RandRange(-50.0f, 50.0f), 0);
-			DisperseVelocities.Add(Velocity);
 
 			// Disable physics so we control the animation
 			D->Mesh->SetSimulatePhysics(false);
-		}
-	}
-
-	for (ADice* D : PlayerDice)
-	{
-		if (D && IsValid(D))
-		{
-			DispersingDice.Add(D);
-			DisperseStartPositions.Add(D->GetActorLocation());
-			DisperseStartScales.Add(D->DiceSize * D->MeshNormalizeScale);
 
-			// Random outward velocity with upward arc
-			FVector ToCenter = (D->GetActorLocation() - Center).GetSafeNormal();
-			FVector Velocity = ToCenter * FMath::RandRange(150.0f, 300.0f);
-			Velocity.Z = FMath::RandRange(100.0f, 200.0f);
-			Velocity += FVector(FMath::RandRange(-50.0f, 50.0f), FMath::RandRange(-50.0f, 50.0f), 0);
-			DisperseVelocities.Add(Velocity);
+			// Fast launch that drags to a stop over the half second, spinning down, shrinking to 20% and fading
+			FDiceBallisticParams Params;
+			Params.Velocity = Velocity * 4.0f;
+			Params.Drag = 3.2f;
+			Params.Gravity = 800.0f;
+			Params.Spin = FRotator((DispersingDice.Num() % 2 == 0 ? 1.0f : -1.0f) * 500.0f, 350.0f, 650.0f);
+			Params.SpinDamping = 4.0f;
+			Params.Lifetime = 0.5f;
+			Params.ScaleTarget = D->Mesh;
+			Params.ScaleEnd = 0.2f;
+			Params.AlphaEnd = 0.0f;
+			Params.OnAlpha = [D](float Alpha)
+			{
+				FColor TextColor = D->TextColor;
+				TextColor.A = FMath::Clamp(int32(255 * Alpha), 0, 255);
+				for (UTextRenderComponent* Text : D->FaceTexts)
+				{
+					if (Text)
+					{
+						UDiceLabelBatcher::SetColor(Text, TextColor);
+					}
+				}
+			};
 
-			// Disable physics so we control the animation
-			D->Mesh->SetSimulatePhysics(false);
+			DispersingDice.Add(D);
+			DisperseBodies.Add(Ballistics.Add(D, MoveTemp(Params)));
 		}
 	}
 
@@ -1985,50 +2239,16 @@ void ADiceGameManager::UpdateDiceDisperse(float DeltaTime)
 {
 	if (!bDiceDispersing) return;
 
+	// Motion, spin, shrink and fade all run in Ballistics - this only ends it
 	DiceDisperseProgress += DeltaTime * 2.0f;  // Animation speed
-	float Alpha = FMath::Clamp(DiceDisperseProgress, 0.0f, 1.0f);
-
-	// Ease out for smooth deceleration
-	float EasedAlpha = 1.0f - FMath::Pow(1.0f - Alpha, 2.0f);
-
-	for (int32 i = 0; i < DispersingDice.Num(); i++)
-	{
-		ADice* D = DispersingDice[i];
-		if (!D || !IsValid(D)) continue;
-
-		// Move along velocity with gravity
-		FVector NewPos = DisperseStartPositions[i] + DisperseVelocities[i] * EasedAlpha;
-		// Add gravity curve
-		NewPos.Z -= 100.0f * Alpha * Alpha;
-		D->SetActorLocation(NewPos);
-
-		// Spin wildly
-		FRotator CurrentRot = D->GetActorRotation();
-		float SpinSpeed = (1.0f - Alpha) * 500.0f;  // Slow down over time
-		CurrentRot.Pitch += DeltaTime * SpinSpeed * (i % 2 == 0 ? 1.0f : -1.0f);
-		CurrentRot.Yaw += DeltaTime * SpinSpeed * 0.7f;
-		CurrentRot.Roll += DeltaTime * SpinSpeed * 1.3f;
-		D->SetActorRotation(CurrentRot);
-
-		// Shrink and fade
-		float Scale = DisperseStartScales[i] * (1.0f - Alpha * 0.8f);  // Shrink to 20%
-		D->Mesh->SetWorldScale3D(FVector(Scale));
-
-		// Fade out text
-		for (UTextRenderComponent* Text : D->FaceTexts)
-		{
-			if (Text)
-			{
-				FColor TextColor = D->TextColor;
-				TextColor.A = FMath::Clamp(int32(255 * (1.0f - Alpha)), 0, 255);
-				Text->SetTextRenderColor(TextColor);
-			}
-		}
-	}
 
 	// When animation complete, destroy all
 	if (DiceDisperseProgress >= 1.0f)
 	{
+		for (FDiceBallisticHandle& Body : DisperseBodies)
+		{
+			Ballistics.Remove(Body);
+		}
 		for (ADice* D : DispersingDice)
 		{
 			if (D && IsValid(D))
@@ -2037,13 +2257,12 @@ void ADiceGameManager::UpdateDiceDisperse(float DeltaTime)
 			}
 		}
 		DispersingDice.Empty();
-		DisperseStartPositions.Empty();
-		DisperseVelocities.Empty();
-		DisperseStartScales.Empty();
+		DisperseBodies.Empty();
 		bDiceDispersing = false;
 	}
 }
 
+#if DICE_DEBUG_DRAW
 void ADiceGameManager::DrawTurnText()
 {
 	FString Text;
@@ -2152,6 +2371,7 @@ void ADiceGameManager::DrawHealthBars()
 	FString HealthText = FString::Printf(TEXT("Round %d | Enemy HP: %d/%d | Your HP: %d/%d"), CurrentRound, EnemyHealth, MaxHealth, PlayerHealth, MaxHealth);
 	GEngine->AddOnScreenDebugMessage(4, 0.0f, FColor::White, HealthText, true, FVector2D(1.5f, 1.5f));
 }
+#endif
 
 FRotator ADiceGameManager::GetRotationForFaceUp(int32 FaceValue)
 {
@@ -2172,9 +2392,7 @@ AMaskEnemy* ADiceGameManager::FindEnemy()
 
 ADiceCamera* ADiceGameManager::FindCamera()
 {
-	TArray<AActor*> Cameras;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ADiceCamera::StaticClass(), Cameras);
-	return (Cameras.Num() > 0) ? Cast<ADiceCamera>(Cameras[0]) : nullptr;
+	return ADiceCamera::Get(this);
 }
 
 // ==================== MOUSE INPUT ====================
@@ -2197,7 +2415,7 @@ void ADiceGameManager::OnMousePressed()
 	}
 
 	if (CurrentPhase != EGamePhase::PlayerMatching) return;
-	if (bDiceReturning || bDiceSnappingToModifier || bDiceFlipping || bMatchAnimating || bWaitingForCameraToRerollAll || bDiceLiftingForReroll || bModifierShuffling) return;
+	if (bIsDragging) return;
 
 	FVector HitLocation;
 	AActor* HitActor = GetActorUnderMouse(HitLocation);
@@ -2210,6 +2428,13 @@ void ADiceGameManager::OnMousePressed()
 		{
 			if (PlayerDice[i] == HitDice && !PlayerDiceMatched[i])
 			{
+				if (IsMatchInputBlocked(i))
+				{
+					// Still busy - pick it up as soon as it's free (if the button is still held)
+					QueueInput(EQueuedInput::PickUp, HitDice);
+					return;
+				}
+
 				StartDragging(HitDice, i);
 				return;
 			}
@@ -2269,6 +2494,9 @@ void ADiceGameManager::OnMouseReleased()
 		return;
 	}
 
+	// A press that never turned into a drag is dropped with the button
+	QueuedInputs.RemoveAll([](const FQueuedInput& Input) { return Input.Type == EQueuedInput::PickUp; });
+
 	if (!bIsDragging || CurrentPhase != EGamePhase::PlayerMatching) return;
 	if (!DraggedDice) return;
 
@@ -2282,7 +2510,7 @@ void ADiceGameManager::OnMouseReleased()
 
 	for (int32 i = 0; i < EnemyDice.Num(); i++)
 	{
-		if (EnemyDice[i] && !EnemyDiceMatched[i])
+		if (EnemyDice[i] && !EnemyDiceMatched[i] && !IsEnemyDiceClaimed(i))
 		{
 			float Dist = FVector::Dist(DicePos, EnemyDice[i]->GetActorLocation());
 			if (Dist < ClosestEnemyDist)
@@ -2296,7 +2524,7 @@ void ADiceGameManager::OnMouseReleased()
 	if (ClosestEnemy >= 0)
 	{
 		TryMatchDice(DraggedDiceIndex, ClosestEnemy);
-		bSuccess = PlayerDiceMatched[DraggedDiceIndex] || bMatchAnimating;
+		bSuccess = PlayerDiceMatched[DraggedDiceIndex] || IsDiceAnimating(DraggedDiceIndex);
 	}
 
 	// Check modifiers only if not matching enemy dice (combos allowed!)
@@ -2359,15 +2587,19 @@ void ADiceGameManager::UpdateMouseInput()
 {
 	if (bIsDragging)
 	{
-		UpdateDragging();
+		// Normally moved in LateTick - highlights use the die where it was last drawn
+		if (CVarDiceLegacyDrag.GetValueOnGameThread())
+		{
+			UpdateDragging(GetWorld()->GetDeltaSeconds(), false);
+		}
 		HighlightValidTargets();
 	}
-	else if (!bDiceReturning && !bDiceSnappingToModifier && !bDiceFlipping && !bMatchAnimating && !bDiceLiftingForReroll && !bModifierShuffling)
+	else if (!IsMatchInputBlocked(INDEX_NONE))
 	{
 		FVector HitLocation;
 		AActor* HitActor = GetActorUnderMouse(HitLocation);
 
-		// Find which player dice (if any) is being hovered
+		// Find which player dice (if any) is being hovered - busy dice can't be picked up yet
 		ADice* NewHoveredDice = nullptr;
 		if (HitActor)
 		{
@@ -2376,7 +2608,7 @@ void ADiceGameManager::UpdateMouseInput()
 			{
 				for (int32 i = 0; i < PlayerDice.Num(); i++)
 				{
-					if (PlayerDice[i] == HitDice && !PlayerDiceMatched[i])
+					if (PlayerDice[i] == HitDice && !PlayerDiceMatched[i] && !IsMatchInputBlocked(i))
 					{
 						NewHoveredDice = HitDice;
 						break;
@@ -2393,12 +2625,17 @@ void ADiceGameManager::UpdateMouseInput()
 				SoundManager->PlayHover();
 			}
 		}
+		if (NewHoveredDice != LastHoveredDice && EventBus)
+		{
+			EventBus->Publish(FDiceHoveredEvent{ NewHoveredDice, LastHoveredDice });
+		}
 		LastHoveredDice = NewHoveredDice;
 
 		// Only update highlights if hovered dice changed
-		for (ADice* D : PlayerDice)
+		for (int32 i = 0; i < PlayerDice.Num(); i++)
 		{
-			if (D && !D->bIsMatched)
+			ADice* D = PlayerDice[i];
+			if (D && !D->bIsMatched && !IsDiceAnimating(i))
 			{
 				bool bShouldHighlight = (D == NewHoveredDice);
 				if (D->bIsHighlighted != bShouldHighlight)
@@ -2444,6 +2681,44 @@ FVector ADiceGameManager::GetMouseWorldPosition()
 	if (!PC->DeprojectMousePositionToWorld(WorldLocation, WorldDirection))
 		return FVector::ZeroVector;
 
+	return ProjectToDragPlane(WorldLocation, WorldDirection);
+}
+
+bool ADiceGameManager::GetLateMouseWorldPosition(FVector& OutWorld, double& OutSampleTime)
+{
+	// Ask the OS where the cursor is right now - the viewport's mouse position is only refreshed when messages are pumped at frame start
+	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
+	UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport();
+	FSceneViewport* SceneViewport = ViewportClient ? ViewportClient->GetGameViewport() : nullptr;
+	if (!PC || !SceneViewport || !FSlateApplication::IsInitialized())
+	{
+		return false;
+	}
+
+	const FGeometry& Geometry = SceneViewport->GetCachedGeometry();
+	const FVector2D LocalSize = Geometry.GetLocalSize();
+	if (LocalSize.X <= 0.0f || LocalSize.Y <= 0.0f)
+	{
+		return false;
+	}
+
+	OutSampleTime = FPlatformTime::Seconds();
+	const FVector2D CursorLocal = Geometry.AbsoluteToLocal(FSlateApplication::Get().GetCursorPos());
+	const FIntPoint ViewportSize = SceneViewport->GetSizeXY();
+	const FVector2D ScreenPos = CursorLocal * FVector2D(ViewportSize.X / LocalSize.X, ViewportSize.Y / LocalSize.Y);
+
+	FVector WorldLocation, WorldDirection;
+	if (!PC->DeprojectScreenPositionToWorld(ScreenPos.X, ScreenPos.Y, WorldLocation, WorldDirection))
+	{
+		return false;
+	}
+
+	OutWorld = ProjectToDragPlane(WorldLocation, WorldDirection);
+	return true;
+}
+
+FVector ADiceGameManager::ProjectToDragPlane(const FVector& WorldLocation, const FVector& WorldDirection) const
+{
 	// Intersect with a plane at table level
 	float PlaneZ = bIsDragging ? (OriginalDragPosition.Z + DragHeight) : DiceLineupHeight;
 	if (FMath::Abs(WorldDirection.Z) > KINDA_SMALL_NUMBER)
@@ -2470,6 +2745,10 @@ void ADiceGameManager::StartDragging(ADice* Dice, int32 Index)
 	DraggedDice = Dice;
 	DraggedDiceIndex = Index;
 
+	// The press was pumped at the start of this frame
+	DragStartInputTime = FApp::GetCurrentTime();
+	bDragFirstMotion = true;
+
 	// Get the base position/rotation (before hover) if available
 	if (Dice->bHighlightRotSet)
 	{
@@ -2538,10 +2817,12 @@ void ADiceGameManager::PhysicsBounceBack()
 	}
 
 	// Start tracking return (we'll re-settle and re-lineup this dice)
-	bDiceReturning = true;
-	ReturningDice = DraggedDice;
-	ReturningDiceIndex = DraggedDiceIndex;
-	ReturnProgress = 0.0f;
+	if (PlayerDice.IsValidIndex(DraggedDiceIndex))
+	{
+		FPlayerDiceAnim& Anim = StartDiceAnim(DraggedDiceIndex, EDiceAnim::Return);
+		Anim.TargetPos = OriginalDragPosition;
+		Anim.TargetRot = OriginalDragRotation;
+	}
 
 	bIsDragging = false;
 	DraggedDice = nullptr;
@@ -2572,18 +2853,14 @@ void ADiceGameManager::StopDragging(bool bSuccess)
 	else
 	{
 		// Fail - start juicy return
-		bDiceReturning = true;
-		ReturningDice = DraggedDice;
-		ReturningDiceIndex = DraggedDiceIndex;
-		ReturnProgress = 0.0f;
-		ReturnStartPos = DraggedDice->GetActorLocation();
-		ReturnStartRot = DraggedDice->GetActorRotation();
-		ReturnTargetPos = OriginalDragPosition;
-		ReturnTargetRot = OriginalDragRotation;
-
-		// Calculate release velocity for physics feel
-		FVector CurrentPos = DraggedDice->GetActorLocation();
-		ReturnVelocity = (CurrentPos - LastDragPosition) / FMath::Max(GetWorld()->GetDeltaSeconds(), 0.001f);
+		if (PlayerDice.IsValidIndex(DraggedDiceIndex))
+		{
+			FPlayerDiceAnim& Anim = StartDiceAnim(DraggedDiceIndex, EDiceAnim::Return);
+			Anim.StartPos = DraggedDice->GetActorLocation();
+			Anim.StartRot = DraggedDice->GetActorRotation();
+			Anim.TargetPos = OriginalDragPosition;
+			Anim.TargetRot = OriginalDragRotation;
+		}
 
 		bIsDragging = false;
 		DraggedDice = nullptr;
@@ -2591,11 +2868,25 @@ void ADiceGameManager::StopDragging(bool bSuccess)
 	}
 }
 
-void ADiceGameManager::UpdateDragging()
+void ADiceGameManager::UpdateDragging(float DeltaTime, bool bLateSample)
 {
 	if (!DraggedDice) return;
 
-	FVector MouseWorld = GetMouseWorldPosition();
+	FVector MouseWorld;
+	double SampleTime = 0.0;
+	double InputTime = 0.0;
+	if (bLateSample && GetLateMouseWorldPosition(MouseWorld, SampleTime))
+	{
+		InputTime = SampleTime;
+	}
+	else
+	{
+		// Cursor as of the frame-start message pump
+		MouseWorld = GetMouseWorldPosition();
+		InputTime = FApp::GetCurrentTime();
+		SampleTime = FPlatformTime::Seconds();
+	}
+
 	FVector TargetPosition = MouseWorld;
 	// Lift dice above its original position
 	TargetPosition.Z = OriginalDragPosition.Z + DragHeight;
@@ -2603,73 +2894,331 @@ void ADiceGameManager::UpdateDragging()
 	FVector CurrentPos = DraggedDice->GetActorLocation();
 	LastDragPosition = CurrentPos;
 
-	// Direct mouse follow with smoothing
-	FVector NewPosition = FMath::VInterpTo(CurrentPos, TargetPosition, GetWorld()->GetDeltaSeconds(), DragFollowSpeed);
-	DraggedDice->SetActorLocation(NewPosition);
+	// Exponential smoothing - the remaining gap shrinks by the same fraction per second whatever the frame rate
+	const float SafeDelta = FMath::Max(DeltaTime, 0.001f);
+	const float FollowAlpha = DragFollowSpeed > 0.0f ? 1.0f - FMath::Exp(-DragFollowSpeed * SafeDelta) : 1.0f;
+	FVector NewPosition = FMath::Lerp(CurrentPos, TargetPosition, FollowAlpha);
 
 	// Tilt based on velocity
-	FVector Velocity = (NewPosition - CurrentPos) / FMath::Max(GetWorld()->GetDeltaSeconds(), 0.001f);
+	FVector Velocity = (NewPosition - CurrentPos) / SafeDelta;
 
 	FRotator TargetRot = OriginalDragRotation;
 	TargetRot.Roll += FMath::Clamp(Velocity.Y * DragTiltAmount * 0.01f, -20.0f, 20.0f);
 	TargetRot.Pitch += FMath::Clamp(-Velocity.X * DragTiltAmount * 0.01f, -20.0f, 20.0f);
 
-	FRotator CurrentRot = DraggedDice->GetActorRotation();
-	FRotator NewRot = FMath::RInterpTo(CurrentRot, TargetRot, GetWorld()->GetDeltaSeconds(), 12.0f);
-	DraggedDice->SetActorRotation(NewRot);
+	const float TiltAlpha = 1.0f - FMath::Exp(-12.0f * SafeDelta);
+	FRotator NewRot = FMath::Lerp(DraggedDice->GetActorRotation(), TargetRot, TiltAlpha);
+	DraggedDice->SetActorLocationAndRotation(NewPosition, NewRot);
+
+	if (CVarDiceLatencyTrace.GetValueOnGameThread())
+	{
+		TraceDragLatency(bDragFirstMotion ? DragStartInputTime : InputTime, SampleTime);
+	}
+	bDragFirstMotion = false;
+}
+
+// Render-thread side of dice.Input.LatencyTrace
+namespace DiceDragLatency
+{
+	struct FStamp
+	{
+		double InputTime;
+		double SampleTime;
+		bool bFirstMotion;
+	};
+
+	// Render thread only
+	static TArray<FStamp> PendingStamps;
+	static double SumInputToPresent = 0.0;
+	static double MaxInputToPresent = 0.0;
+	static double SumSampleToPresent = 0.0;
+	static int32 NumFrames = 0;
+
+	static void OnBackBufferReadyToPresent(SWindow& Window, const FTextureRHIRef& BackBuffer)
+	{
+		if (PendingStamps.Num() == 0) return;
+
+		const double PresentTime = FPlatformTime::Seconds();
+		for (const FStamp& Stamp : PendingStamps)
+		{
+			const double InputMs = (PresentTime - Stamp.InputTime) * 1000.0;
+			const double SampleMs = (PresentTime - Stamp.SampleTime) * 1000.0;
+
+			if (Stamp.bFirstMotion)
+			{
+				UE_LOG(LogDiceGame, Log, TEXT("Drag latency: click -> first present %.1f ms (cursor sample -> present %.1f ms)"), InputMs, SampleMs);
+				continue;
+			}
+
+			SumInputToPresent += InputMs;
+			MaxInputToPresent = FMath::Max(MaxInputToPresent, InputMs);
+			SumSampleToPresent += SampleMs;
+			NumFrames++;
+		}
+		PendingStamps.Reset();
+
+		if (NumFrames >= 60)
+		{
+			UE_LOG(LogDiceGame, Log, TEXT("Drag latency: cursor -> present avg %.1f ms, max %.1f ms (sample -> present avg %.1f ms) over %d frames"),
+				SumInputToPresent / NumFrames, MaxInputToPresent, SumSampleToPresent / NumFrames, NumFrames);
+			SumInputToPresent = 0.0;
+			MaxInputToPresent = 0.0;
+			SumSampleToPresent = 0.0;
+			NumFrames = 0;
+		}
+	}
+}
+
+void ADiceGameManager::TraceDragLatency(double InputTime, double SampleTime)
+{
+	// Hook the present once - the handler only touches render-thread statics, so it never needs removing
+	static bool bPresentHooked = false;
+	if (!bPresentHooked)
+	{
+		if (!FSlateApplication::IsInitialized() || !FSlateApplication::Get().GetRenderer())
+		{
+			return;
+		}
+		FSlateApplication::Get().GetRenderer()->OnBackBufferReadyToPresent().AddStatic(&DiceDragLatency::OnBackBufferReadyToPresent);
+		bPresentHooked = true;
+	}
+
+	// Queued behind this frame's scene, so the next present after it is the one showing this move
+	DiceDragLatency::FStamp Stamp{ InputTime, SampleTime, bDragFirstMotion };
+	ENQUEUE_RENDER_COMMAND(DiceDragLatencyStamp)([Stamp](FRHICommandListImmediate&)
+	{
+		DiceDragLatency::PendingStamps.Add(Stamp);
+	});
 }
 
-void ADiceGameManager::UpdateDiceReturn(float DeltaTime)
+void ADiceGameManager::UpdateDiceReturn(int32 DiceIndex, float DeltaTime)
 {
-	if (!bDiceReturning || !ReturningDice) return;
+	FPlayerDiceAnim& Anim = PlayerDiceAnims[DiceIndex];
+
+	ADice* Dice = PlayerDice.IsValidIndex(DiceIndex) ? PlayerDice[DiceIndex] : nullptr;
+	if (!Dice)
+	{
+		Anim.Type = EDiceAnim::None;
+		return;
+	}
 
 	// Check if physics is enabled (bounce back mode)
-	if (ReturningDice->Mesh->IsSimulatingPhysics())
+	if (Dice->Mesh->IsSimulatingPhysics())
 	{
 		// Wait for dice to settle
-		ReturnProgress += DeltaTime;
+		Anim.Progress += DeltaTime;
 
-		FVector Vel = ReturningDice->Mesh->GetPhysicsLinearVelocity();
-		FVector AngVel = ReturningDice->Mesh->GetPhysicsAngularVelocityInDegrees();
+		FVector Vel = Dice->Mesh->GetPhysicsLinearVelocity();
+		FVector AngVel = Dice->Mesh->GetPhysicsAngularVelocityInDegrees();
 
 		bool bSettled = (Vel.Size() < 5.0f && AngVel.Size() < 5.0f);
-		bool bTimedOut = (ReturnProgress > 3.0f);  // Max 3 seconds
+		bool bTimedOut = (Anim.Progress > 3.0f);  // Max 3 seconds
 
 		if (bSettled || bTimedOut)
 		{
 			// Disable physics and smoothly move to lineup position
-			ReturningDice->Mesh->SetSimulatePhysics(false);
+			Dice->Mesh->SetSimulatePhysics(false);
 
-			ReturnStartPos = ReturningDice->GetActorLocation();
-			ReturnStartRot = ReturningDice->GetActorRotation();
-			ReturnTargetPos = OriginalDragPosition;
-			ReturnTargetRot = OriginalDragRotation;
-			ReturnProgress = 0.0f;
+			Anim.StartPos = Dice->GetActorLocation();
+			Anim.StartRot = Dice->GetActorRotation();
+			Anim.Progress = 0.0f;
 		}
 		return;
 	}
 
 	// Smooth animation back to lineup
-	ReturnProgress += DeltaTime * 4.0f;
-	float Alpha = FMath::Clamp(ReturnProgress, 0.0f, 1.0f);
+	Anim.Progress += DeltaTime * 4.0f;
+	float Alpha = FMath::Clamp(Anim.Progress, 0.0f, 1.0f);
 
 	// Smooth ease
 	float SmoothAlpha = EaseOutCubic(Alpha);
 
-	FVector NewPos = FMath::Lerp(ReturnStartPos, ReturnTargetPos, SmoothAlpha);
-	FRotator NewRot = FMath::Lerp(ReturnStartRot, ReturnTargetRot, SmoothAlpha);
+	FVector NewPos = FMath::Lerp(Anim.StartPos, Anim.TargetPos, SmoothAlpha);
+	FRotator NewRot = FMath::Lerp(Anim.StartRot, Anim.TargetRot, SmoothAlpha);
+
+	Dice->SetActorLocation(NewPos);
+	Dice->SetActorRotation(NewRot);
+
+	if (Anim.Progress >= 1.0f)
+	{
+		Dice->SetActorLocation(Anim.TargetPos);
+		Dice->SetActorRotation(Anim.TargetRot);
+		Anim.Type = EDiceAnim::None;
+	}
+}
+
+// ==================== PER-DIE ANIMATION ====================
+
+ADiceGameManager::FPlayerDiceAnim& ADiceGameManager::StartDiceAnim(int32 DiceIndex, EDiceAnim Type)
+{
+	if (PlayerDiceAnims.Num() < PlayerDice.Num())
+	{
+		PlayerDiceAnims.SetNum(PlayerDice.Num());
+	}
+
+	FPlayerDiceAnim& Anim = PlayerDiceAnims[DiceIndex];
+	Anim = FPlayerDiceAnim();
+	Anim.Type = Type;
+	return Anim;
+}
+
+bool ADiceGameManager::IsDiceAnimating(int32 DiceIndex) const
+{
+	return PlayerDiceAnims.IsValidIndex(DiceIndex) && PlayerDiceAnims[DiceIndex].Type != EDiceAnim::None;
+}
+
+bool ADiceGameManager::IsAnyDiceAnimating() const
+{
+	for (const FPlayerDiceAnim& Anim : PlayerDiceAnims)
+	{
+		if (Anim.Type != EDiceAnim::None) return true;
+	}
+	return false;
+}
+
+bool ADiceGameManager::IsEnemyDiceClaimed(int32 EnemyIndex) const
+{
+	for (const FPlayerDiceAnim& Anim : PlayerDiceAnims)
+	{
+		if (Anim.Type == EDiceAnim::Match && Anim.EnemyIndex == EnemyIndex) return true;
+	}
+	return false;
+}
+
+void ADiceGameManager::RunWhenDiceAnimsIdle(TFunction<void()>&& Action)
+{
+	if (!IsAnyDiceAnimating() && !bIsDragging && AfterDiceAnims.Num() == 0)
+	{
+		Action();
+		return;
+	}
+	AfterDiceAnims.Add(MoveTemp(Action));
+}
+
+void ADiceGameManager::UpdatePlayerDiceAnims(float DeltaTime)
+{
+	// Completions can end the round and clear the array, so re-check the bounds every step
+	for (int32 i = 0; i < PlayerDiceAnims.Num(); i++)
+	{
+		switch (PlayerDiceAnims[i].Type)
+		{
+			case EDiceAnim::Return:
+				UpdateDiceReturn(i, DeltaTime);
+				break;
+			case EDiceAnim::Snap:
+				UpdateModifierSnap(i, DeltaTime);
+				break;
+			case EDiceAnim::Flip:
+				UpdateDiceFlip(i, DeltaTime);
+				break;
+			case EDiceAnim::Match:
+				UpdateMatchAnimation(i, DeltaTime);
+				break;
+			default:
+				break;
+		}
+	}
+
+	// Rerolls move the whole hand, so they wait until every die is free
+	if (AfterDiceAnims.Num() > 0 && !IsAnyDiceAnimating() && !bIsDragging)
+	{
+		TArray<TFunction<void()>> Actions = MoveTemp(AfterDiceAnims);
+		AfterDiceAnims.Reset();
+		for (TFunction<void()>& Action : Actions)
+		{
+			Action();
+		}
+	}
+}
+
+void ADiceGameManager::ResetDiceAnims()
+{
+	PlayerDiceAnims.Empty();
+	AfterDiceAnims.Empty();
+	QueuedInputs.Empty();
+}
+
+// ==================== INPUT QUEUE ====================
+
+bool ADiceGameManager::IsMatchInputBlocked(int32 DiceIndex) const
+{
+	// Whole-hand animations still block everything
+	if (bWaitingForCameraToRerollAll || bDiceLiftingForReroll || bModifierShuffling || AfterDiceAnims.Num() > 0)
+	{
+		return true;
+	}
+
+	if (CVarDiceSerialAnimations.GetValueOnGameThread())
+	{
+		return IsAnyDiceAnimating();
+	}
+
+	return DiceIndex != INDEX_NONE && IsDiceAnimating(DiceIndex);
+}
+
+bool ADiceGameManager::IsGiveUpBlocked() const
+{
+	return IsMatchInputBlocked(INDEX_NONE) || IsAnyDiceAnimating() || bIsDragging;
+}
+
+void ADiceGameManager::QueueInput(EQueuedInput Type, ADice* Dice)
+{
+	// Only the latest request of each kind matters
+	QueuedInputs.RemoveAll([Type](const FQueuedInput& Input) { return Input.Type == Type; });
+	QueuedInputs.Add({ Type, Dice });
+	MatchingQueuedCount++;
+}
+
+void ADiceGameManager::ProcessQueuedInputs()
+{
+	if (QueuedInputs.Num() == 0) return;
+
+	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
+
+	for (int32 q = 0; q < QueuedInputs.Num(); q++)
+	{
+		const FQueuedInput Input = QueuedInputs[q];
+
+		if (Input.Type == EQueuedInput::PickUp)
+		{
+			int32 Index = PlayerDice.Find(Input.Dice);
+			bool bStillWanted = PC && PC->IsInputKeyDown(EKeys::LeftMouseButton) && !bIsDragging;
+			if (!bStillWanted || Index == INDEX_NONE || PlayerDiceMatched[Index])
+			{
+				QueuedInputs.RemoveAt(q--);
+				continue;
+			}
 
-	ReturningDice->SetActorLocation(NewPos);
-	ReturningDice->SetActorRotation(NewRot);
+			if (!IsMatchInputBlocked(Index))
+			{
+				QueuedInputs.RemoveAt(q--);
+				StartDragging(Input.Dice, Index);
+			}
+		}
+		else if (Input.Type == EQueuedInput::GiveUp)
+		{
+			if (!IsGiveUpBlocked())
+			{
+				// Resets the round (and the queue)
+				GiveUpRound();
+				return;
+			}
+		}
+	}
+}
 
-	if (ReturnProgress >= 1.0f)
+void ADiceGameManager::ReportMatchingThroughput()
+{
+	if (MatchingActiveTime > 0.0f)
 	{
-		ReturningDice->SetActorLocation(ReturnTargetPos);
-		ReturningDice->SetActorRotation(ReturnTargetRot);
-		bDiceReturning = false;
-		ReturningDice = nullptr;
-		ReturningDiceIndex = -1;
+		UE_LOG(LogDiceGame, Log, TEXT("Matching: %d actions in %.2fs (%.2f actions/s), %d inputs queued [%s]"),
+			MatchingActionCount, MatchingActiveTime, MatchingActionCount / MatchingActiveTime, MatchingQueuedCount,
+			CVarDiceSerialAnimations.GetValueOnGameThread() ? TEXT("serial animations") : TEXT("per-die animations"));
 	}
+
+	MatchingActiveTime = 0.0f;
+	MatchingActionCount = 0;
+	MatchingQueuedCount = 0;
 }
 
 void ADiceGameManager::HighlightValidTargets()
@@ -2685,7 +3234,7 @@ void ADiceGameManager::HighlightValidTargets()
 	{
 		if (EnemyDice[i] && EnemyDiceMatched.IsValidIndex(i) && !EnemyDiceMatched[i] && EnemyResults.IsValidIndex(i))
 		{
-			bool bCanMatch = (EnemyResults[i] == DraggedValue);
+			bool bCanMatch = (EnemyResults[i] == DraggedValue) && !IsEnemyDiceClaimed(i);
 			EnemyDice[i]->SetHighlighted(bCanMatch);
 		}
 	}
@@ -2696,10 +3245,14 @@ void ADiceGameManager::HighlightValidTargets()
 	{
 		if (Mod && !Mod->bIsUsed && Mod->bIsActive)
 		{
-			if (!Mod->CanApplyToValue(DraggedValue))
+			if (!Mod->GetRow().CanApply(DraggedValue))
 			{
 				// Can't apply this modifier to current value (e.g., +1 on 6)
-				Mod->SetHighlighted(false);
+				// Unhighlighting clears the invalid flag, so only do it when there is a highlight to drop
+				if (Mod->bIsHighlighted)
+				{
+					Mod->SetHighlighted(false);
+				}
 				Mod->SetInvalid(true);
 			}
 			else
@@ -2777,13 +3330,14 @@ void ADiceGameManager::StartCameraPan()
 
 	if (!bCameraAtMatchView)
 	{
-		OriginalCameraLocation = Cam->GetActorLocation();
-		OriginalCameraRotation = Cam->GetActorRotation();
+		Cam->GetPoseBelow(ECameraLayer::Pan, OriginalCameraLocation, OriginalCameraRotation);
 	}
 
 	CameraPanProgress = 0.0f;
 	bCameraPanning = true;
 	bCameraAtMatchView = true;
+	bCameraArrived = false;
+	UnsignalPhaseGate(EPhaseGate::CameraPan);
 }
 
 FVector ADiceGameManager::GetLineupWorldCenter()
@@ -2824,21 +3378,39 @@ void ADiceGameManager::UpdateCameraPan(float DeltaTime)
 		TargetRot = OriginalCameraRotation;
 	}
 
-	FVector NewLoc = FMath::Lerp(Cam->GetActorLocation(), TargetLoc, SmoothAlpha * 0.12f);
-	FRotator NewRot = FMath::Lerp(Cam->GetActorRotation(), TargetRot, SmoothAlpha * 0.12f);
+	// Pick up from wherever the camera sits under the pan layer
+	if (!Cam->IsPoseLayerActive(ECameraLayer::Pan))
+	{
+		Cam->GetPoseBelow(ECameraLayer::Pan, CameraPanLocation, CameraPanRotation);
+	}
+
+	FVector NewLoc = FMath::Lerp(CameraPanLocation, TargetLoc, SmoothAlpha * 0.12f);
+	FRotator NewRot = FMath::Lerp(CameraPanRotation, TargetRot, SmoothAlpha * 0.12f);
+	CameraPanLocation = NewLoc;
+	CameraPanRotation = NewRot;
 
-	Cam->SetActorLocation(NewLoc);
-	Cam->SetActorRotation(NewRot);
+	Cam->SetPoseLayer(ECameraLayer::Pan, NewLoc, NewRot);
+
+	// Arrived once we're visually there - the lerp tail keeps easing in after this
+	if (!bCameraArrived)
+	{
+		bool bCloseEnough = FVector::Dist(NewLoc, TargetLoc) <= CameraArriveTolerance && NewRot.Equals(TargetRot, 2.0f);
+		if (bCloseEnough || CameraPanProgress >= 2.0f)
+		{
+			bCameraArrived = true;
+			float Hold = IsLegacyPacing() ? FMath::Max(0.0f, (2.0f - CameraPanProgress) / CameraPanSpeed) : 0.0f;
+			SignalPhaseGate(EPhaseGate::CameraPan, Hold);
+		}
+	}
 
 	if (CameraPanProgress >= 2.0f)
 	{
 		bCameraPanning = false;
 
-		// If we were waiting for camera to finish before enemy chop, do it now
-		if (bWaitingForCameraThenEnemyChop)
+		// Back home - hand the camera back to the base pose
+		if (!bCameraAtMatchView)
 		{
-			bWaitingForCameraThenEnemyChop = false;
-			TriggerEnemyChop();
+			Cam->ClearPoseLayer(ECameraLayer::Pan);
 		}
 	}
 }
@@ -2848,8 +3420,11 @@ void ADiceGameManager::ResetCamera()
 	bCameraAtMatchView = false;
 	CameraPanProgress = 0.0f;
 	bCameraPanning = true;
+	bCameraArrived = false;
+	UnsignalPhaseGate(EPhaseGate::CameraPan);
 }
 
+#if DICE_DEBUG_DRAW
 // ==================== ADJUST MODE ====================
 
 void ADiceGameManager::UpdateAdjustMode()
@@ -3023,14 +3598,14 @@ void ADiceGameManager::DrawAdjustGizmos()
 
 void ADiceGameManager::PrintCurrentSettings()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== LINEUP SETTINGS ==="));
-	UE_LOG(LogTemp, Warning, TEXT("LineupCenter = FVector(%.1ff, %.1ff, %.1ff);"), LineupCenter.X, LineupCenter.Y, LineupCenter.Z);
-	UE_LOG(LogTemp, Warning, TEXT("LineupYaw = %.1ff;"), LineupYaw);
-	UE_LOG(LogTemp, Warning, TEXT("EnemyRowOffset = %.1ff;"), EnemyRowOffset);
-	UE_LOG(LogTemp, Warning, TEXT("PlayerRowOffset = %.1ff;"), PlayerRowOffset);
-	UE_LOG(LogTemp, Warning, TEXT("DiceLineupSpacing = %.1ff;"), DiceLineupSpacing);
-	UE_LOG(LogTemp, Warning, TEXT("DiceLineupHeight = %.1ff;"), DiceLineupHeight);
-	UE_LOG(LogTemp, Warning, TEXT("========================"));
+	UE_LOG(LogDiceGame, Log, TEXT("=== LINEUP SETTINGS ==="));
+	UE_LOG(LogDiceGame, Log, TEXT("LineupCenter = FVector(%.1ff, %.1ff, %.1ff);"), LineupCenter.X, LineupCenter.Y, LineupCenter.Z);
+	UE_LOG(LogDiceGame, Log, TEXT("LineupYaw = %.1ff;"), LineupYaw);
+	UE_LOG(LogDiceGame, Log, TEXT("EnemyRowOffset = %.1ff;"), EnemyRowOffset);
+	UE_LOG(LogDiceGame, Log, TEXT("PlayerRowOffset = %.1ff;"), PlayerRowOffset);
+	UE_LOG(LogDiceGame, Log, TEXT("DiceLineupSpacing = %.1ff;"), DiceLineupSpacing);
+	UE_LOG(LogDiceGame, Log, TEXT("DiceLineupHeight = %.1ff;"), DiceLineupHeight);
+	UE_LOG(LogDiceGame, Log, TEXT("========================"));
 
 	// Also show on screen
 	GEngine->AddOnScreenDebugMessage(-1, 10.0f, FColor::Green, TEXT("Settings printed to Output Log!"));
@@ -3069,6 +3644,7 @@ void ADiceGameManager::UpdateTestDice()
 	TestDice->SetActorRotation(Rot);
 	TestDice->SetActorLocation(GetLineupWorldCenter() + FVector(0, 0, 50.0f));
 }
+#endif
 
 // ==================== MATCH DETECTION ====================
 
@@ -3106,13 +3682,16 @@ bool ADiceGameManager::CanStillMatch()
 		{
 			for (ADiceModifier* Mod : AvailableModifiers)
 			{
+				const FDiceModifierRow& Row = Mod->GetRow();
+
 				// Skip RerollOne and RerollAll for now - they're wildcards (always could potentially help)
-				if (Mod->ModifierType == EModifierType::RerollOne || Mod->ModifierType == EModifierType::RerollAll)
+				if (Row.Reroll != EModifierReroll::None)
 				{
 					return true;  // Reroll exists = could potentially match
 				}
 
-				int32 ModifiedVal = Mod->ApplyToValue(PlayerVal);
+				if (!Row.CanApply(PlayerVal)) continue;  // Can't be dropped on this face
+				int32 ModifiedVal = Row.Results[PlayerVal];
 				if (ModifiedVal == PlayerVal) continue;  // No effect
 
 				// Check if modified value matches any enemy
@@ -3133,6 +3712,8 @@ bool ADiceGameManager::CanStillMatch()
 
 void ADiceGameManager::GiveUpRound()
 {
+	ReportMatchingThroughput();
+
 	// Hide the fold prompt
 	StartDiceLabelTypewriterOut();
 
@@ -3157,7 +3738,12 @@ void ADiceGameManager::GiveUpRound()
 	EnemyDiceMatched.Empty();
 	PlayerDiceModified.Empty();
 	PlayerDiceAtModifier.Empty();
-	WaitTimer = 0.0f;
+	ResetDiceAnims();
+	for (int32 Gate = 0; Gate < (int32)EPhaseGate::Count; Gate++)
+	{
+		CancelPhaseGate((EPhaseGate)Gate);
+	}
+	bRerollThrowQueued = false;
 	SelectionMode = 0;
 	SelectedDiceIndex = -1;
 
@@ -3169,7 +3755,7 @@ void ADiceGameManager::ContinueToNextRound()
 {
 	// Increment round counter
 	CurrentRound++;
-	UE_LOG(LogTemp, Warning, TEXT("ContinueToNextRound - Now Round %d"), CurrentRound);
+	UE_LOG(LogDiceGame, Log, TEXT("ContinueToNextRound - Now Round %d"), CurrentRound);
 
 	// Handle temporary bonus dice reset logic:
 	// - If we just finished a bonus round, don't reset yet (play this round with bonus dice)
@@ -3180,14 +3766,14 @@ void ADiceGameManager::ContinueToNextRound()
 		// Next round will reset
 		bBonusRoundJustEnded = false;
 		// bBonusActiveThisRound was set in ShowBonusResult, so next call will reset
-		UE_LOG(LogTemp, Warning, TEXT("Starting bonus-affected round with %d dice"), PlayerNumDice);
+		UE_LOG(LogDiceGame, Log, TEXT("Starting bonus-affected round with %d dice"), PlayerNumDice);
 	}
 	else if (bBonusActiveThisRound)
 	{
 		// Finished the bonus-affected round - reset dice count to base
 		PlayerNumDice = BaseDiceCount;
 		bBonusActiveThisRound = false;
-		UE_LOG(LogTemp, Warning, TEXT("Bonus effect expired, reset to %d dice"), PlayerNumDice);
+		UE_LOG(LogDiceGame, Log, TEXT("Bonus effect expired, reset to %d dice"), PlayerNumDice);
 	}
 
 	// Clear dice but keep permanent modifier state
@@ -3199,7 +3785,12 @@ void ADiceGameManager::ContinueToNextRound()
 	EnemyDiceMatched.Empty();
 	PlayerDiceModified.Empty();
 	PlayerDiceAtModifier.Empty();
-	WaitTimer = 0.0f;
+	ResetDiceAnims();
+	for (int32 Gate = 0; Gate < (int32)EPhaseGate::Count; Gate++)
+	{
+		CancelPhaseGate((EPhaseGate)Gate);
+	}
+	bRerollThrowQueued = false;
 	SelectionMode = 0;
 	SelectedDiceIndex = -1;
 
@@ -3223,71 +3814,99 @@ void ADiceGameManager::ResetModifiersForNewRound()
 	}
 }
 
-void ADiceGameManager::StartModifierShuffle()
+void ADiceGameManager::GetShuffleableModifiers(TArray<ADiceModifier*>& OutModifiers) const
 {
-	// Get list of available (non-permanently-removed) modifiers - exclude bonus modifiers
-	TArray<ADiceModifier*> AvailableModifiers;
+	// Available (non-permanently-removed) modifiers - exclude bonus modifiers
+	OutModifiers.Reset();
 	for (ADiceModifier* Mod : AllModifiers)
 	{
 		if (Mod && !PermanentlyRemovedModifiers.Contains(Mod) &&
 			Mod->ModifierType != EModifierType::BonusHigher &&
 			Mod->ModifierType != EModifierType::BonusLower)
 		{
-			AvailableModifiers.Add(Mod);
+			OutModifiers.Add(Mod);
 		}
 	}
+}
+
+void ADiceGameManager::BuildModifierShufflePlan(const TArray<ADiceModifier*>& Available, int32 ForRound, FModifierShufflePlan& OutPlan)
+{
+	OutPlan.Round = ForRound;
+	OutPlan.Available = Available;
+
+	// Pick a random modifier to permanently remove (if this isn't round 1)
+	OutPlan.RemoveIndex = INDEX_NONE;
+	if (ForRound > 1 && Available.Num() > 1)  // Keep at least 1 modifier
+	{
+		OutPlan.RemoveIndex = FMath::RandRange(0, Available.Num() - 1);
+	}
+
+	// Shuffle positions for juicy effect
+	int32 NumRemaining = Available.Num() - (OutPlan.RemoveIndex != INDEX_NONE ? 1 : 0);
+	OutPlan.TargetOrder.Reset(NumRemaining);
+	for (int32 i = 0; i < NumRemaining; i++)
+	{
+		OutPlan.TargetOrder.Add(i);
+	}
+	for (int32 i = NumRemaining - 1; i > 0; i--)
+	{
+		int32 j = FMath::RandRange(0, i);
+		OutPlan.TargetOrder.Swap(i, j);
+	}
+}
+
+void ADiceGameManager::StartModifierShuffle()
+{
+	TArray<ADiceModifier*> AvailableModifiers;
+	GetShuffleableModifiers(AvailableModifiers);
 
 	// If no modifiers left, skip shuffle
 	if (AvailableModifiers.Num() == 0)
 	{
+		ModifierShufflePlan = FModifierShufflePlan();
 		bModifierShuffling = false;
 		ActivateModifiers();
 		return;
 	}
 
+	// Use the plan drawn during the chop if nothing changed since
+	FModifierShufflePlan Plan;
+	if (ModifierShufflePlan.Round == CurrentRound && ModifierShufflePlan.Available == AvailableModifiers)
+	{
+		Plan = MoveTemp(ModifierShufflePlan);
+	}
+	else
+	{
+		BuildModifierShufflePlan(AvailableModifiers, CurrentRound, Plan);
+	}
+	ModifierShufflePlan = FModifierShufflePlan();
+
 	// Reset all available modifiers to usable
 	ResetModifiersForNewRound();
 
-	// Pick a random modifier to permanently remove (if this isn't round 1)
-	if (CurrentRound > 1 && AvailableModifiers.Num() > 1)  // Keep at least 1 modifier
+	if (Plan.RemoveIndex != INDEX_NONE)
 	{
-		int32 RemoveIndex = FMath::RandRange(0, AvailableModifiers.Num() - 1);
-		FadingModifier = AvailableModifiers[RemoveIndex];
+		FadingModifier = AvailableModifiers[Plan.RemoveIndex];
 		PermanentlyRemovedModifiers.Add(FadingModifier);
-		AvailableModifiers.RemoveAt(RemoveIndex);
-		UE_LOG(LogTemp, Warning, TEXT("Round %d: Removing modifier '%s' (%d remaining)"),
+		AvailableModifiers.RemoveAt(Plan.RemoveIndex);
+		UE_LOG(LogDiceGame, Log, TEXT("Round %d: Removing modifier '%s' (%d remaining)"),
 			CurrentRound, *FadingModifier->GetModifierDisplayText(), AvailableModifiers.Num());
 	}
 	else
 	{
 		FadingModifier = nullptr;
-		UE_LOG(LogTemp, Warning, TEXT("Round %d: No modifier removed (%d available)"),
+		UE_LOG(LogDiceGame, Log, TEXT("Round %d: No modifier removed (%d available)"),
 			CurrentRound, AvailableModifiers.Num());
 	}
 
-	// Store current positions and calculate target positions (shuffle!)
+	// Store current positions and assign shuffled target positions
 	ModifierStartPositions.Empty();
 	ModifierTargetPositions.Empty();
 
-	// Get all current positions
-	TArray<FVector> AllPositions;
-	for (ADiceModifier* Mod : AvailableModifiers)
-	{
-		AllPositions.Add(Mod->GetActorLocation());
-	}
-
-	// Shuffle positions for juicy effect
-	for (int32 i = AllPositions.Num() - 1; i > 0; i--)
-	{
-		int32 j = FMath::RandRange(0, i);
-		AllPositions.Swap(i, j);
-	}
-
-	// Assign shuffled positions
 	for (int32 i = 0; i < AvailableModifiers.Num(); i++)
 	{
 		ModifierStartPositions.Add(AvailableModifiers[i]->GetActorLocation());
-		ModifierTargetPositions.Add(AllPositions[i]);
+		ModifierTargetPositions.Add(AvailableModifiers[Plan.TargetOrder[i]]->GetActorLocation());
 	}
 
 	bModifierShuffling = true;
@@ -3306,17 +3925,9 @@ void ADiceGameManager::UpdateModifierShuffle(float DeltaTime)
 	float SmoothAlpha = EaseOutElastic(Alpha);
 	float LinearAlpha = EaseOutCubic(Alpha);
 
-	// Get available modifiers (same order as positions) - exclude bonus modifiers
+	// Get available modifiers (same order as positions)
 	TArray<ADiceModifier*> AvailableModifiers;
-	for (ADiceModifier* Mod : AllModifiers)
-	{
-		if (Mod && !PermanentlyRemovedModifiers.Contains(Mod) &&
-			Mod->ModifierType != EModifierType::BonusHigher &&
-			Mod->ModifierType != EModifierType::BonusLower)
-		{
-			AvailableModifiers.Add(Mod);
-		}
-	}
+	GetShuffleableModifiers(AvailableModifiers);
 
 	// Animate modifiers to new positions
 	for (int32 i = 0; i < AvailableModifiers.Num(); i++)
@@ -3342,7 +3953,7 @@ void ADiceGameManager::UpdateModifierShuffle(float DeltaTime)
 
 		// Just fade the color smoothly
 		uint8 FadeAlpha = FMath::Clamp(int32(FadingModifierAlpha * 255), 0, 255);
-		FadingModifier->ModifierText->SetTextRenderColor(FColor(255, 100, 100, FadeAlpha));
+		UDiceLabelBatcher::SetColor(FadingModifier->ModifierText, FColor(255, 100, 100, FadeAlpha));
 	}
 
 	// When shuffle is done
@@ -3363,7 +3974,7 @@ void ADiceGameManager::UpdateModifierShuffle(float DeltaTime)
 		{
 			FadingModifier->SetHidden(true);  // Hide entire actor
 			FadingModifier->SetActive(false);
-			UE_LOG(LogTemp, Warning, TEXT("Modifier '%s' permanently removed (Round %d)"),
+			UE_LOG(LogDiceGame, Log, TEXT("Modifier '%s' permanently removed (Round %d)"),
 				*FadingModifier->GetModifierDisplayText(), CurrentRound);
 			FadingModifier = nullptr;
 		}
@@ -3380,6 +3991,7 @@ void ADiceGameManager::UpdateModifierShuffle(float DeltaTime)
 	}
 }
 
+#if DICE_DEBUG_DRAW
 void ADiceGameManager::UpdateFaceRotationMode()
 {
 	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
@@ -3449,10 +4061,10 @@ void ADiceGameManager::UpdateFaceRotationMode()
 	if (PC->IsInputKeyDown(EKeys::P) && !bPHeld)
 	{
 		bPHeld = true;
-		UE_LOG(LogTemp, Warning, TEXT("=== FACE ROTATIONS ==="));
+		UE_LOG(LogDiceGame, Log, TEXT("=== FACE ROTATIONS ==="));
 		for (int32 i = 1; i <= 6; i++)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("FaceRotations[%d] = FRotator(%.0f, %.0f, %.0f);"),
+			UE_LOG(LogDiceGame, Log, TEXT("FaceRotations[%d] = FRotator(%.0f, %.0f, %.0f);"),
 				i, FaceRotations[i].Pitch, FaceRotations[i].Yaw, FaceRotations[i].Roll);
 		}
 		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Green, TEXT("Printed to Output Log!"));
@@ -3474,31 +4086,192 @@ void ADiceGameManager::UpdateFaceRotationMode()
 				*Marker, i, FaceRotations[i].Pitch, FaceRotations[i].Yaw, FaceRotations[i].Roll));
 	}
 }
+#endif
 
-// ===== HAND INTEGRATION =====
+// ===== TIMERS =====
 
-UPlayerHandComponent* ADiceGameManager::GetPlayerHand()
+FDiceTimerHandle ADiceGameManager::ScheduleTimer(float Delay, TFunction<void()>&& Callback, float RepeatInterval)
 {
-	if (PlayerHandActor)
-	{
-		return PlayerHandActor->FindComponentByClass<UPlayerHandComponent>();
-	}
-	return nullptr;
+	UDiceTimerWheel* Wheel = UDiceTimerWheel::Get(this);
+	return Wheel ? Wheel->Schedule(this, Delay, MoveTemp(Callback), RepeatInterval) : FDiceTimerHandle();
 }
 
-UPlayerHandComponent* ADiceGameManager::GetEnemyHand()
+void ADiceGameManager::CancelTimer(FDiceTimerHandle& Handle)
 {
-	if (EnemyHandActor)
+	if (UDiceTimerWheel* Wheel = UDiceTimerWheel::Get(this))
 	{
-		return EnemyHandActor->FindComponentByClass<UPlayerHandComponent>();
+		Wheel->Cancel(Handle);
 	}
-	return nullptr;
+	Handle.Invalidate();
 }
 
-URoundTimerComponent* ADiceGameManager::GetRoundTimer()
+// ==================== PHASE GATES ====================
+
+bool ADiceGameManager::IsLegacyPacing() const
 {
-	if (CachedRoundTimer)
-	{
+	return CVarDiceLegacyPacing.GetValueOnGameThread();
+}
+
+void ADiceGameManager::ArmPhaseGate(EPhaseGate Gate, float MinDwell, TFunction<void()>&& Continuation)
+{
+	FPhaseGate& G = PhaseGates[(int32)Gate];
+	CancelTimer(G.DwellHandle);
+
+	G.Continuation = MoveTemp(Continuation);
+	G.ArmedTime = GetWorld()->GetTimeSeconds();
+	G.SignalTime = G.ArmedTime;
+	G.SignalRealTime = FPlatformTime::Seconds();
+	G.MinDwell = FMath::Max(0.0f, MinDwell);
+	G.HoldAfterSignal = 0.0f;
+	G.bArmed = true;
+
+	// Keep a signal that arrived before anyone was waiting (e.g. camera already home)
+	if (G.bSignalled)
+	{
+		TryOpenPhaseGate(Gate);
+	}
+}
+
+void ADiceGameManager::SignalPhaseGate(EPhaseGate Gate, float HoldAfterSignal)
+{
+	FPhaseGate& G = PhaseGates[(int32)Gate];
+	if (G.bSignalled) return;
+
+	G.bSignalled = true;
+	G.SignalTime = GetWorld()->GetTimeSeconds();
+	G.SignalRealTime = FPlatformTime::Seconds();
+	G.HoldAfterSignal = FMath::Max(0.0f, HoldAfterSignal);
+
+	if (G.bArmed)
+	{
+		TryOpenPhaseGate(Gate);
+	}
+}
+
+void ADiceGameManager::UnsignalPhaseGate(EPhaseGate Gate)
+{
+	FPhaseGate& G = PhaseGates[(int32)Gate];
+	G.bSignalled = false;
+	G.HoldAfterSignal = 0.0f;
+	CancelTimer(G.DwellHandle);
+}
+
+void ADiceGameManager::CancelPhaseGate(EPhaseGate Gate)
+{
+	FPhaseGate& G = PhaseGates[(int32)Gate];
+	CancelTimer(G.DwellHandle);
+	G.Continuation = nullptr;
+	G.bArmed = false;
+	G.bSignalled = false;
+	G.HoldAfterSignal = 0.0f;
+}
+
+void ADiceGameManager::TryOpenPhaseGate(EPhaseGate Gate)
+{
+	FPhaseGate& G = PhaseGates[(int32)Gate];
+	if (!G.bArmed || !G.bSignalled) return;
+
+	double Now = GetWorld()->GetTimeSeconds();
+	double ReadyTime = FMath::Max(G.ArmedTime + G.MinDwell, G.SignalTime + G.HoldAfterSignal);
+
+	if (Now + 0.001 < ReadyTime)
+	{
+		// Done, but the dwell/hold hasn't elapsed yet
+		CancelTimer(G.DwellHandle);
+		G.DwellHandle = ScheduleTimer(float(ReadyTime - Now), [this, Gate]() { TryOpenPhaseGate(Gate); });
+		return;
+	}
+
+	PacingDeadWait += float(FPlatformTime::Seconds() - G.SignalRealTime);
+	PacingTransitions++;
+
+	TFunction<void()> Continuation = MoveTemp(G.Continuation);
+	G.Continuation = nullptr;
+	G.bArmed = false;
+	G.bSignalled = false;
+	G.HoldAfterSignal = 0.0f;
+	G.DwellHandle.Invalidate();
+
+	if (Continuation)
+	{
+		Continuation();
+	}
+}
+
+void ADiceGameManager::RunAfterCameraPan(TFunction<void()>&& Continuation)
+{
+	ArmPhaseGate(EPhaseGate::CameraPan, 0.0f, MoveTemp(Continuation));
+
+	if (!bCameraPanning || bCameraArrived || !FindCamera())
+	{
+		SignalPhaseGate(EPhaseGate::CameraPan);
+	}
+}
+
+void ADiceGameManager::ArmEnemySettleGate()
+{
+	bEnemyDiceSettled = false;
+	UnsignalPhaseGate(EPhaseGate::EnemyDiceSettled);
+	ArmPhaseGate(EPhaseGate::EnemyDiceSettled, IsLegacyPacing() ? 0.0f : SettleMinDwell, [this]()
+	{
+		if (CurrentPhase != EGamePhase::EnemyDiceSettling) return;
+
+		PrepareEnemyDiceLineup();
+		LineupProgress = 0.0f;
+		CurrentPhase = EGamePhase::EnemyDiceLining;
+	});
+}
+
+void ADiceGameManager::ArmPlayerSettleGate()
+{
+	bPlayerDiceSettled = false;
+	UnsignalPhaseGate(EPhaseGate::PlayerDiceSettled);
+	ArmPhaseGate(EPhaseGate::PlayerDiceSettled, IsLegacyPacing() ? 0.0f : SettleMinDwell, [this]()
+	{
+		if (CurrentPhase != EGamePhase::PlayerDiceSettling) return;
+
+		PreparePlayerDiceLineup();
+		PlayerLineupProgress = 0.0f;
+		CurrentPhase = EGamePhase::PlayerDiceLining;
+	});
+}
+
+void ADiceGameManager::ReportRoundPacing()
+{
+	if (PacingRound <= 0) return;
+
+	float RoundTime = float(FPlatformTime::Seconds() - PacingRoundStartTime);
+	float DeadPct = RoundTime > 0.0f ? 100.0f * PacingDeadWait / RoundTime : 0.0f;
+
+	UE_LOG(LogDiceGame, Log, TEXT("Pacing: round %d took %.2fs, %.2fs (%.1f%%) waiting after phases were done, %d transitions [%s]"),
+		PacingRound, RoundTime, PacingDeadWait, DeadPct, PacingTransitions,
+		IsLegacyPacing() ? TEXT("legacy waits") : TEXT("completion gates"));
+}
+
+// ===== HAND INTEGRATION =====
+
+UPlayerHandComponent* ADiceGameManager::GetPlayerHand()
+{
+	if (PlayerHandActor)
+	{
+		return PlayerHandActor->FindComponentByClass<UPlayerHandComponent>();
+	}
+	return nullptr;
+}
+
+UPlayerHandComponent* ADiceGameManager::GetEnemyHand()
+{
+	if (EnemyHandActor)
+	{
+		return EnemyHandActor->FindComponentByClass<UPlayerHandComponent>();
+	}
+	return nullptr;
+}
+
+URoundTimerComponent* ADiceGameManager::GetRoundTimer()
+{
+	if (CachedRoundTimer)
+	{
 		return CachedRoundTimer;
 	}
 
@@ -3531,6 +4304,12 @@ void ADiceGameManager::TriggerPlayerChop()
 	// Deal damage to player health
 	DealDamage(false);
 
+	// Get the next round ready while the knife comes down
+	if (PlayerHealth > 0)
+	{
+		StageNextRound();
+	}
+
 	UPlayerHandComponent* Hand = GetPlayerHand();
 	if (Hand && Hand->FingersRemaining > 0)
 	{
@@ -3549,6 +4328,12 @@ void ADiceGameManager::TriggerEnemyChop()
 	// Deal damage to enemy health
 	DealDamage(true);
 
+	// Get the next round ready while the knife comes down
+	if (EnemyHealth > 0)
+	{
+		StageNextRound();
+	}
+
 	UPlayerHandComponent* Hand = GetEnemyHand();
 	if (Hand && Hand->FingersRemaining > 0)
 	{
@@ -3709,12 +4494,12 @@ void ADiceGameManager::OnBonusButtonPressed(EIRButtonType ButtonType)
 	if (ButtonType == EIRButtonType::Yes)
 	{
 		bBonusRoundAccepted = true;
-		UE_LOG(LogTemp, Warning, TEXT("BONUS ROUND ACCEPTED! Starting Masquerade..."));
+		UE_LOG(LogDiceGame, Log, TEXT("BONUS ROUND ACCEPTED! Starting Masquerade..."));
 	}
 	else
 	{
 		bBonusRoundAccepted = false;
-		UE_LOG(LogTemp, Warning, TEXT("Bonus round declined. Continuing..."));
+		UE_LOG(LogDiceGame, Log, TEXT("Bonus round declined. Continuing..."));
 	}
 
 	// Return camera to game view
@@ -3742,10 +4527,6 @@ void ADiceGameManager::StartBonusButtonCameraFocus()
 	ADiceCamera* Cam = FindCamera();
 	if (!Cam) return;
 
-	// Store original camera position (use the game's stored original, not current)
-	BonusCameraOriginalPos = OriginalCameraLocation;
-	BonusCameraOriginalRot = OriginalCameraRotation;
-
 	// Find center between both buttons
 	FVector ButtonCenter = FVector::ZeroVector;
 	int32 ButtonCount = 0;
@@ -3782,7 +4563,7 @@ void ADiceGameManager::StartBonusButtonCameraFocus()
 		BonusCameraTargetRot = FRotator(BonusCameraPitch, LookDir.Rotation().Yaw, 0.0f);
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Bonus Camera: Target Pos (%.1f, %.1f, %.1f), Button Center (%.1f, %.1f, %.1f)"),
+	UE_LOG(LogDiceGame, Log, TEXT("Bonus Camera: Target Pos (%.1f, %.1f, %.1f), Button Center (%.1f, %.1f, %.1f)"),
 		BonusCameraTargetPos.X, BonusCameraTargetPos.Y, BonusCameraTargetPos.Z,
 		ButtonCenter.X, ButtonCenter.Y, ButtonCenter.Z);
 
@@ -3809,10 +4590,7 @@ void ADiceGameManager::UpdateBonusCameraFocus(float DeltaTime)
 		BonusCameraProgress = FMath::Clamp(BonusCameraProgress, 0.0f, 1.0f);
 
 		float T = EaseOutCubic(BonusCameraProgress);
-		FVector NewPos = FMath::Lerp(BonusCameraOriginalPos, BonusCameraTargetPos, T);
-		FRotator NewRot = FMath::Lerp(BonusCameraOriginalRot, BonusCameraTargetRot, T);
-		Cam->SetActorLocation(NewPos);
-		Cam->SetActorRotation(NewRot);
+		Cam->SetPoseLayer(ECameraLayer::BonusFocus, BonusCameraTargetPos, BonusCameraTargetRot, T);
 
 		if (BonusCameraProgress >= 1.0f)
 		{
@@ -3825,51 +4603,58 @@ void ADiceGameManager::UpdateBonusCameraFocus(float DeltaTime)
 		BonusCameraProgress = FMath::Clamp(BonusCameraProgress, 0.0f, 1.0f);
 
 		float T = EaseOutCubic(BonusCameraProgress);
-		FVector NewPos = FMath::Lerp(BonusCameraTargetPos, BonusCameraOriginalPos, T);
-		FRotator NewRot = FMath::Lerp(BonusCameraTargetRot, BonusCameraOriginalRot, T);
-		Cam->SetActorLocation(NewPos);
-		Cam->SetActorRotation(NewRot);
+		Cam->SetPoseLayer(ECameraLayer::BonusFocus, BonusCameraTargetPos, BonusCameraTargetRot, 1.0f - T);
 
 		if (BonusCameraProgress >= 1.0f)
 		{
 			bBonusCameraReturning = false;
+			Cam->ClearPoseLayer(ECameraLayer::BonusFocus);
 		}
 	}
 }
 
 // ==================== BONUS ROUND GAMEPLAY ====================
 
-int32 ADiceGameManager::GenerateBonusTotal()
+void ADiceGameManager::GenerateBonusDice()
 {
-	// Generate two dice values where sum is NOT 7
-	int32 Die1, Die2, Total;
-	do
+	// Two dice conditioned on the sum not being 7: every one of the 30 remaining (Die1, Die2) pairs is
+	// equally likely, so pick one directly. Each die row skips exactly one pair (the one making 7).
+	const int32 Pick = FMath::RandRange(0, 29);
+	const int32 Die1 = Pick / 5 + 1;
+	int32 Die2 = Pick % 5 + 1;
+	if (Die2 >= 7 - Die1)
 	{
-		Die1 = FMath::RandRange(1, 6);
-		Die2 = FMath::RandRange(1, 6);
-		Total = Die1 + Die2;
-	} while (Total == 7);
+		Die2++;  // Step over 7 - Die1
+	}
 
-	return Total;
+	BonusEnemyFaces[0] = Die1;
+	BonusEnemyFaces[1] = Die2;
+	BonusEnemyTotal = Die1 + Die2;
 }
 
 void ADiceGameManager::StartBonusRoundGame()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== BONUS ROUND START ==="));
+	UE_LOG(LogDiceGame, Log, TEXT("=== BONUS ROUND START ==="));
 
 	CleanupBonusRound();
 
 	BonusPhase = 1;  // Throwing
 	BonusAnimTimer = 0.0f;
+	BonusWaitHandle = ScheduleTimer(0.2f, [this]()
+	{
+		if (BonusPhase != 1) return;
+		BonusPhase = 2;  // Enemy settling
+		BonusAnimTimer = 0.0f;
+	});
 	BonusDiceModifier = 0;
 	BonusLineupProgress = 0.0f;
 
-	// Generate the enemy total (not 7)
-	BonusEnemyTotal = GenerateBonusTotal();
+	// Decide the enemy dice (total not 7) before anything is thrown
+	GenerateBonusDice();
 	bBonusIsHigher = (BonusEnemyTotal > 7);
 
-	UE_LOG(LogTemp, Warning, TEXT("Bonus Enemy Total: %d (%s than 7)"),
-		BonusEnemyTotal, bBonusIsHigher ? TEXT("HIGHER") : TEXT("LOWER"));
+	UE_LOG(LogDiceGame, Log, TEXT("Bonus Enemy Total: %d = %d + %d (%s than 7)"),
+		BonusEnemyTotal, BonusEnemyFaces[0], BonusEnemyFaces[1], bBonusIsHigher ? TEXT("HIGHER") : TEXT("LOWER"));
 
 	// Throw the masked dice
 	ThrowBonusMaskedDice();
@@ -3877,12 +4662,6 @@ void ADiceGameManager::StartBonusRoundGame()
 
 void ADiceGameManager::ThrowBonusMaskedDice()
 {
-	// Calculate dice values that sum to BonusEnemyTotal
-	int32 Die1 = FMath::RandRange(1, FMath::Min(6, BonusEnemyTotal - 1));
-	int32 Die2 = BonusEnemyTotal - Die1;
-	Die1 = FMath::Clamp(Die1, 1, 6);
-	Die2 = FMath::Clamp(Die2, 1, 6);
-
 	// Use same spawn logic as normal enemy dice
 	AMaskEnemy* Enemy = FindEnemy();
 	FVector SpawnBase;
@@ -3903,7 +4682,7 @@ void ADiceGameManager::ThrowBonusMaskedDice()
 
 	for (int32 i = 0; i < 2; i++)
 	{
-		int32 DieValue = (i == 0) ? Die1 : Die2;
+		int32 DieValue = BonusEnemyFaces[i];
 
 		FVector SpawnOffset = FVector(
 			FMath::RandRange(-15.0f, 15.0f),
@@ -3949,7 +4728,7 @@ void ADiceGameManager::ThrowBonusMaskedDice()
 
 			BonusMaskedDice.Add(Dice);
 
-			UE_LOG(LogTemp, Warning, TEXT("Spawned masked dice %d at %s with value %d"),
+			UE_LOG(LogDiceGame, Log, TEXT("Spawned masked dice %d at %s with value %d"),
 				i, *SpawnLocation.ToString(), DieValue);
 		}
 	}
@@ -3981,7 +4760,9 @@ void ADiceGameManager::CheckBonusDiceSettled()
 		}
 	}
 
-	if (bAllSettled && BonusAnimTimer > 0.5f)
+	// The faces were picked up front and the lineup turns each die onto its own, so there is no reason
+	// to wait out a long tumble
+	if ((bAllSettled && BonusAnimTimer > 0.5f) || BonusAnimTimer > BonusSettleTimeout)
 	{
 		BonusPhase = 3;  // Lining up
 		PrepareBonusDiceLineup();
@@ -4025,10 +4806,12 @@ void ADiceGameManager::PrepareBonusDiceLineup()
 		BonusDiceTargetPositions.Add(TargetPos);
 		BonusDiceTargetRotations.Add(GetRotationForFaceUp(Dice->CurrentValue));
 
-		// Disable physics
+		// Disable physics - the die may still be rolling if the settle timed out
 		UPrimitiveComponent* PrimComp = Cast<UPrimitiveComponent>(Dice->GetRootComponent());
 		if (PrimComp)
 		{
+			PrimComp->SetPhysicsLinearVelocity(FVector::ZeroVector);
+			PrimComp->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
 			PrimComp->SetSimulatePhysics(false);
 		}
 	}
@@ -4058,6 +4841,12 @@ void ADiceGameManager::LineUpBonusDice(float DeltaTime)
 		// Move to player throw phase
 		BonusPhase = 4;
 		BonusAnimTimer = 0.0f;
+		BonusWaitHandle = ScheduleTimer(0.2f, [this]()
+		{
+			if (BonusPhase != 4) return;
+			BonusPhase = 5;  // Player settling
+			BonusAnimTimer = 0.0f;
+		});
 
 		// Throw player's YES dice
 		ThrowBonusPlayerDice();
@@ -4069,8 +4858,9 @@ void ADiceGameManager::LineUpBonusDice(float DeltaTime)
 		{
 			if (BonusMaskedDice[i] && i < BonusDiceStartPositions.Num())
 			{
+				// Slerp so the die takes the shortest turn from however it landed onto its decided face
 				FVector NewPos = FMath::Lerp(BonusDiceStartPositions[i], BonusDiceTargetPositions[i], T);
-				FRotator NewRot = FMath::Lerp(BonusDiceStartRotations[i], BonusDiceTargetRotations[i], T);
+				FQuat NewRot = FQuat::Slerp(BonusDiceStartRotations[i].Quaternion(), BonusDiceTargetRotations[i].Quaternion(), T);
 				BonusMaskedDice[i]->SetActorLocation(NewPos);
 				BonusMaskedDice[i]->SetActorRotation(NewRot);
 			}
@@ -4084,7 +4874,7 @@ void ADiceGameManager::ThrowBonusPlayerDice()
 	ADiceCamera* Cam = FindCamera();
 	if (!Cam)
 	{
-		UE_LOG(LogTemp, Error, TEXT("No camera found for bonus player dice throw!"));
+		UE_LOG(LogDiceGame, Error, TEXT("No camera found for bonus player dice throw!"));
 		return;
 	}
 
@@ -4138,7 +4928,7 @@ void ADiceGameManager::ThrowBonusPlayerDice()
 		);
 		BonusPlayerDice->Throw(ThrowDirection, DiceThrowForce);
 
-		UE_LOG(LogTemp, Warning, TEXT("Spawned bonus player YES dice at %s"), *SpawnLocation.ToString());
+		UE_LOG(LogDiceGame, Log, TEXT("Spawned bonus player YES dice at %s"), *SpawnLocation.ToString());
 	}
 
 	if (SoundManager)
@@ -4146,7 +4936,7 @@ void ADiceGameManager::ThrowBonusPlayerDice()
 		SoundManager->PlayDiceRoll();
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Player YES dice thrown!"));
+	UE_LOG(LogDiceGame, Log, TEXT("Player YES dice thrown!"));
 }
 
 void ADiceGameManager::CheckBonusPlayerDiceSettled()
@@ -4256,7 +5046,7 @@ void ADiceGameManager::StartBonusPlayerTurn()
 	// Start the glitchy typewriter UI
 	StartMasqueradeTypewriter();
 
-	UE_LOG(LogTemp, Warning, TEXT("Drag YES dice to >7 or <7 modifier!"));
+	UE_LOG(LogDiceGame, Log, TEXT("Drag YES dice to >7 or <7 modifier!"));
 }
 
 void ADiceGameManager::StartBonusDiceSnap(ADiceModifier* Modifier, bool bChoseHigher)
@@ -4283,7 +5073,7 @@ void ADiceGameManager::StartBonusDiceSnap(ADiceModifier* Modifier, bool bChoseHi
 		BonusPlayerDice->Mesh->SetSimulatePhysics(false);
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Starting bonus dice snap to modifier"));
+	UE_LOG(LogDiceGame, Log, TEXT("Starting bonus dice snap to modifier"));
 }
 
 void ADiceGameManager::UpdateBonusDiceSnap(float DeltaTime)
@@ -4342,14 +5132,11 @@ void ADiceGameManager::UpdateBonusCameraShake(float DeltaTime)
 	{
 		// Shake complete - remove offset
 		bBonusCameraShaking = false;
-		Cam->SetActorLocation(Cam->GetActorLocation() - BonusCameraShakeOffset);
+		Cam->ClearOffsetLayer(ECameraOffset::BonusShake);
 		BonusCameraShakeOffset = FVector::ZeroVector;
 		return;
 	}
 
-	// Remove old offset
-	FVector CurrentPos = Cam->GetActorLocation() - BonusCameraShakeOffset;
-
 	// Calculate new shake offset (decay over time)
 	float Progress = BonusCameraShakeTimer / BonusCameraShakeDuration;
 	float DecayedIntensity = BonusCameraShakeIntensity * (1.0f - Progress);
@@ -4360,8 +5147,7 @@ void ADiceGameManager::UpdateBonusCameraShake(float DeltaTime)
 		FMath::RandRange(-DecayedIntensity * 0.5f, DecayedIntensity * 0.5f)
 	);
 
-	// Apply new offset
-	Cam->SetActorLocation(CurrentPos + BonusCameraShakeOffset);
+	Cam->SetOffsetLayer(ECameraOffset::BonusShake, BonusCameraShakeOffset);
 }
 
 void ADiceGameManager::OnBonusModifierSelected(bool bHigher)
@@ -4369,7 +5155,7 @@ void ADiceGameManager::OnBonusModifierSelected(bool bHigher)
 	bPlayerGuessedHigher = bHigher;
 	bBonusWon = (bPlayerGuessedHigher == bBonusIsHigher);
 
-	UE_LOG(LogTemp, Warning, TEXT("Player chose: %s"), bHigher ? TEXT(">7") : TEXT("<7"));
+	UE_LOG(LogDiceGame, Log, TEXT("Player chose: %s"), bHigher ? TEXT(">7") : TEXT("<7"));
 
 	// Type out the masquerade UI (glitchy reverse effect)
 	StartMasqueradeTypewriterOut();
@@ -4400,13 +5186,16 @@ void ADiceGameManager::StartBonusRevealSequence()
 
 	// Store original positions for shake
 	MaskedDicePreShakePos.Empty();
-	MaskedDiceFlyVelocity.Empty();
+	for (FDiceBallisticHandle& Body : MaskedDiceFlyBodies)
+	{
+		Ballistics.Remove(Body);
+	}
+	MaskedDiceFlyBodies.Empty();
 	for (ADice* Dice : BonusMaskedDice)
 	{
 		if (Dice)
 		{
 			MaskedDicePreShakePos.Add(Dice->GetActorLocation());
-			MaskedDiceFlyVelocity.Add(FVector::ZeroVector);
 		}
 	}
 
@@ -4448,7 +5237,7 @@ void ADiceGameManager::StartBonusRevealSequence()
 		BonusRevealDice->SetActorHiddenInGame(true);  // Hidden until strike
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Starting bonus reveal sequence. Total: %d"), BonusEnemyTotal);
+	UE_LOG(LogDiceGame, Log, TEXT("Starting bonus reveal sequence. Total: %d"), BonusEnemyTotal);
 }
 
 void ADiceGameManager::UpdateBonusReveal(float DeltaTime)
@@ -4531,10 +5320,13 @@ void ADiceGameManager::UpdateBonusReveal(float DeltaTime)
 						ImpactDir.Normalize();
 
 						float FlySpeed = FMath::RandRange(400.0f, 600.0f);
-						if (MaskedDiceFlyVelocity.IsValidIndex(i))
-						{
-							MaskedDiceFlyVelocity[i] = ImpactDir * FlySpeed;
-						}
+
+						// Knocked off the table - free flight with a tumble
+						FDiceBallisticParams Params;
+						Params.Velocity = ImpactDir * FlySpeed;
+						Params.Gravity = 800.0f;
+						Params.Spin = FRotator(600.0f, 0.0f, 400.0f);
+						MaskedDiceFlyBodies.Add(Ballistics.Add(BonusMaskedDice[i], MoveTemp(Params)));
 					}
 				}
 
@@ -4550,28 +5342,7 @@ void ADiceGameManager::UpdateBonusReveal(float DeltaTime)
 		{
 			BonusAnimTimer += DeltaTime;
 
-			// Fly masked dice away
-			for (int32 i = 0; i < BonusMaskedDice.Num(); i++)
-			{
-				if (BonusMaskedDice[i] && MaskedDiceFlyVelocity.IsValidIndex(i))
-				{
-					FVector Pos = BonusMaskedDice[i]->GetActorLocation();
-					FVector Vel = MaskedDiceFlyVelocity[i];
-
-					// Apply gravity
-					Vel.Z -= 800.0f * DeltaTime;
-					MaskedDiceFlyVelocity[i] = Vel;
-
-					Pos += Vel * DeltaTime;
-					BonusMaskedDice[i]->SetActorLocation(Pos);
-
-					// Spin
-					FRotator Rot = BonusMaskedDice[i]->GetActorRotation();
-					Rot.Pitch += DeltaTime * 600.0f;
-					Rot.Roll += DeltaTime * 400.0f;
-					BonusMaskedDice[i]->SetActorRotation(Rot);
-				}
-			}
+			// Masked dice are flying away in Ballistics
 
 			// Reveal dice settles with bounce
 			if (BonusRevealDice)
@@ -4596,6 +5367,13 @@ void ADiceGameManager::UpdateBonusReveal(float DeltaTime)
 				BonusAnimTimer = 0.0f;
 				BonusBounceCount = 0;
 
+				// Masked dice are off screen by now - stop flying them
+				for (FDiceBallisticHandle& Body : MaskedDiceFlyBodies)
+				{
+					Ballistics.Remove(Body);
+				}
+				MaskedDiceFlyBodies.Empty();
+
 				// Store start positions for both dice
 				if (BonusPlayerDice)
 				{
@@ -4626,29 +5404,51 @@ void ADiceGameManager::UpdateBonusReveal(float DeltaTime)
 				float LaunchSpeed = 250.0f;
 				float LaunchUpward = 350.0f;
 
-				BonusPlayerVelocity = LaunchDir * LaunchSpeed + FVector(0, 0, LaunchUpward);
-				BonusRevealVelocity = LaunchDir * (LaunchSpeed * 0.9f) + FVector(0, 0, LaunchUpward * 1.1f);
-
-				// Add some sideways spread
-				BonusPlayerVelocity += RightDir * FMath::RandRange(-40.0f, 40.0f);
-				BonusRevealVelocity += RightDir * FMath::RandRange(-40.0f, 40.0f);
-
-				// Rotation speeds
-				BonusPlayerRotSpeed = bBonusWon ? 400.0f : 600.0f;
-				BonusRevealRotSpeed = bBonusWon ? 350.0f : 500.0f;
+				// Both bounce on the lineup floor, losing speed and spin with each hit
+				FDiceBallisticParams PlayerParams;
+				PlayerParams.Gravity = 800.0f;
+				PlayerParams.bFloor = true;
+				PlayerParams.FloorZ = BonusResultFloorZ;
+				PlayerParams.Restitution = 0.6f;
+				PlayerParams.Friction = 0.98f;
+				PlayerParams.BounceSpinScale = 0.7f;
+				FDiceBallisticParams RevealParams = PlayerParams;
+
+				// Arc upward then forward, with some sideways spread
+				PlayerParams.Velocity = LaunchDir * LaunchSpeed + FVector(0, 0, LaunchUpward) + RightDir * FMath::RandRange(-40.0f, 40.0f);
+				RevealParams.Velocity = LaunchDir * (LaunchSpeed * 0.9f) + FVector(0, 0, LaunchUpward * 1.1f) + RightDir * FMath::RandRange(-40.0f, 40.0f);
+
+				// Tumble - the winner spins flat, the loser rolls over
+				const float PlayerRotSpeed = bBonusWon ? 400.0f : 600.0f;
+				const float RevealRotSpeed = bBonusWon ? 350.0f : 500.0f;
+				PlayerParams.Spin = bBonusWon
+					? FRotator(PlayerRotSpeed * 0.3f, PlayerRotSpeed, 0.0f)
+					: FRotator(PlayerRotSpeed * 0.5f, 0.0f, PlayerRotSpeed);
+				RevealParams.Spin = FRotator(0.0f, RevealRotSpeed * 0.8f, RevealRotSpeed * 0.4f);
+
+				Ballistics.Remove(BonusPlayerBody);
+				Ballistics.Remove(BonusRevealBody);
+				if (BonusPlayerDice)
+				{
+					BonusPlayerBody = Ballistics.Add(BonusPlayerDice, MoveTemp(PlayerParams));
+				}
+				if (BonusRevealDice)
+				{
+					BonusRevealBody = Ballistics.Add(BonusRevealDice, MoveTemp(RevealParams));
+				}
 
 				// Update modifier text to Lucky!/Unlucky :(
 				if (SelectedBonusModifier && SelectedBonusModifier->ModifierText)
 				{
 					if (bBonusWon)
 					{
-						SelectedBonusModifier->ModifierText->SetText(FText::FromString(TEXT("Lucky!")));
-						SelectedBonusModifier->ModifierText->SetTextRenderColor(FColor::Green);
+						UDiceLabelBatcher::SetText(SelectedBonusModifier->ModifierText, FText::FromString(TEXT("Lucky!")));
+						UDiceLabelBatcher::SetColor(SelectedBonusModifier->ModifierText, FColor::Green);
 					}
 					else
 					{
-						SelectedBonusModifier->ModifierText->SetText(FText::FromString(TEXT("Unlucky :(")));
-						SelectedBonusModifier->ModifierText->SetTextRenderColor(FColor::Red);
+						UDiceLabelBatcher::SetText(SelectedBonusModifier->ModifierText, FText::FromString(TEXT("Unlucky :(")));
+						UDiceLabelBatcher::SetColor(SelectedBonusModifier->ModifierText, FColor::Red);
 					}
 				}
 
@@ -4671,93 +5471,30 @@ void ADiceGameManager::UpdateBonusReveal(float DeltaTime)
 		{
 			BonusAnimTimer += DeltaTime;
 
-			float Gravity = 800.0f;
-			float BounceDamping = 0.6f;
-			float FrictionDamping = 0.98f;
-
-			// Update player dice with physics
-			if (BonusPlayerDice)
-			{
-				FVector Pos = BonusPlayerDice->GetActorLocation();
-
-				// Apply gravity
-				BonusPlayerVelocity.Z -= Gravity * DeltaTime;
-
-				// Apply velocity
-				Pos += BonusPlayerVelocity * DeltaTime;
-
-				// Bounce off floor
-				if (Pos.Z < BonusResultFloorZ)
-				{
-					Pos.Z = BonusResultFloorZ;
-					BonusPlayerVelocity.Z = -BonusPlayerVelocity.Z * BounceDamping;
-					BonusPlayerVelocity.X *= FrictionDamping;
-					BonusPlayerVelocity.Y *= FrictionDamping;
-					BonusPlayerRotSpeed *= 0.7f;
-
-					// Camera shake on bounce
-					if (FMath::Abs(BonusPlayerVelocity.Z) > 50.0f)
-					{
-						StartBonusCameraShake(0.15f, 3.0f);
-						if (SoundManager) SoundManager->PlayDiceRoll();
-					}
-				}
-
-				BonusPlayerDice->SetActorLocation(Pos);
-
-				// Rotation - tumble based on velocity
-				FRotator Rot = BonusPlayerDice->GetActorRotation();
-				float RotAmount = BonusPlayerRotSpeed * DeltaTime;
-				if (bBonusWon)
-				{
-					Rot.Yaw += RotAmount;
-					Rot.Pitch += RotAmount * 0.3f;
-				}
-				else
-				{
-					Rot.Roll += RotAmount;
-					Rot.Pitch += RotAmount * 0.5f;
-				}
-				BonusPlayerDice->SetActorRotation(Rot);
-			}
-
-			// Update reveal dice with physics
-			if (BonusRevealDice)
+			// Both dice move in Ballistics - react to the player dice's hard landings
+			const int32 PlayerBounces = Ballistics.GetBounceCount(BonusPlayerBody);
+			if (PlayerBounces != BonusBounceCount)
 			{
-				FVector Pos = BonusRevealDice->GetActorLocation();
-
-				// Apply gravity
-				BonusRevealVelocity.Z -= Gravity * DeltaTime;
+				BonusBounceCount = PlayerBounces;
 
-				// Apply velocity
-				Pos += BonusRevealVelocity * DeltaTime;
-
-				// Bounce off floor
-				if (Pos.Z < BonusResultFloorZ)
+				// Camera shake on bounce
+				if (Ballistics.GetLastBounceSpeed(BonusPlayerBody) > 50.0f)
 				{
-					Pos.Z = BonusResultFloorZ;
-					BonusRevealVelocity.Z = -BonusRevealVelocity.Z * BounceDamping;
-					BonusRevealVelocity.X *= FrictionDamping;
-					BonusRevealVelocity.Y *= FrictionDamping;
-					BonusRevealRotSpeed *= 0.7f;
+					StartBonusCameraShake(0.15f, 3.0f);
+					if (SoundManager) SoundManager->PlayDiceRoll();
 				}
-
-				BonusRevealDice->SetActorLocation(Pos);
-
-				// Rotation
-				FRotator Rot = BonusRevealDice->GetActorRotation();
-				float RotAmount = BonusRevealRotSpeed * DeltaTime;
-				Rot.Yaw += RotAmount * 0.8f;
-				Rot.Roll += RotAmount * 0.4f;
-				BonusRevealDice->SetActorRotation(Rot);
 			}
 
 			// Transition when dice have mostly settled (low velocity)
-			bool bSettled = (BonusPlayerVelocity.Size() < 30.0f && BonusRevealVelocity.Size() < 30.0f)
+			bool bSettled = (Ballistics.GetVelocity(BonusPlayerBody).Size() < 30.0f && Ballistics.GetVelocity(BonusRevealBody).Size() < 30.0f)
 						 || BonusAnimTimer >= 2.0f;
 
 			if (bSettled)
 			{
+				// Leave both dice where they came to rest
+				Ballistics.Remove(BonusPlayerBody);
+				Ballistics.Remove(BonusRevealBody);
+
 				// Move to camera pan out phase
 				BonusRevealPhase = 4;
 				BonusAnimTimer = 0.0f;
@@ -4786,11 +5523,18 @@ void ADiceGameManager::ShowBonusResult()
 {
 	BonusPhase = 9;
 	BonusAnimTimer = 0.0f;
+	BonusWaitHandle = ScheduleTimer(1.5f, [this]()
+	{
+		if (BonusPhase != 9) return;
+		CleanupBonusRound();
+		BonusPhase = 0;
+		ContinueToNextRound();
+	});
 
 	if (bBonusWon)
 	{
 		BonusDiceModifier = 1;
-		UE_LOG(LogTemp, Warning, TEXT("BONUS WIN! +1 dice for next round. Total was %d (%s than 7)"),
+		UE_LOG(LogDiceGame, Log, TEXT("BONUS WIN! +1 dice for next round. Total was %d (%s than 7)"),
 			BonusEnemyTotal, bBonusIsHigher ? TEXT("HIGHER") : TEXT("LOWER"));
 		if (SoundManager) SoundManager->PlayDiceMatch();
 
@@ -4800,7 +5544,7 @@ void ADiceGameManager::ShowBonusResult()
 	else
 	{
 		BonusDiceModifier = -1;
-		UE_LOG(LogTemp, Warning, TEXT("BONUS LOSE! -1 dice for next round. Total was %d (%s than 7)"),
+		UE_LOG(LogDiceGame, Log, TEXT("BONUS LOSE! -1 dice for next round. Total was %d (%s than 7)"),
 			BonusEnemyTotal, bBonusIsHigher ? TEXT("HIGHER") : TEXT("LOWER"));
 		if (SoundManager) SoundManager->PlayError();
 	}
@@ -4826,12 +5570,7 @@ void ADiceGameManager::UpdateBonusRound(float DeltaTime)
 
 	switch (BonusPhase)
 	{
-		case 1:  // Enemy throwing - wait a moment
-			if (BonusAnimTimer > 0.2f)
-			{
-				BonusPhase = 2;  // Enemy settling
-				BonusAnimTimer = 0.0f;
-			}
+		case 1:  // Enemy throwing - BonusWaitHandle moves on to settling
 			break;
 
 		case 2:  // Enemy dice settling
@@ -4842,12 +5581,7 @@ void ADiceGameManager::UpdateBonusRound(float DeltaTime)
 			LineUpBonusDice(DeltaTime);
 			break;
 
-		case 4:  // Player dice throwing
-			if (BonusAnimTimer > 0.2f)
-			{
-				BonusPhase = 5;  // Player settling
-				BonusAnimTimer = 0.0f;
-			}
+		case 4:  // Player dice throwing - BonusWaitHandle moves on to settling
 			break;
 
 		case 5:  // Player dice settling
@@ -4866,13 +5600,7 @@ void ADiceGameManager::UpdateBonusRound(float DeltaTime)
 			UpdateBonusReveal(DeltaTime);
 			break;
 
-		case 9:  // Result pop and finish
-			if (BonusAnimTimer > 1.5f)
-			{
-				CleanupBonusRound();
-				BonusPhase = 0;
-				ContinueToNextRound();
-			}
+		case 9:  // Result pop - BonusWaitHandle finishes the round
 			break;
 	}
 }
@@ -4911,12 +5639,16 @@ void ADiceGameManager::CleanupBonusRound()
 
 	// Clear reveal animation state
 	MaskedDicePreShakePos.Empty();
-	MaskedDiceFlyVelocity.Empty();
+	for (FDiceBallisticHandle& Body : MaskedDiceFlyBodies)
+	{
+		Ballistics.Remove(Body);
+	}
+	MaskedDiceFlyBodies.Empty();
+	Ballistics.Remove(BonusPlayerBody);
+	Ballistics.Remove(BonusRevealBody);
 	BonusRevealPhase = 0;
 	bBonusDiceSnapping = false;
 	SelectedBonusModifier = nullptr;
-	BonusPlayerVelocity = FVector::ZeroVector;
-	BonusRevealVelocity = FVector::ZeroVector;
 
 	// Stop camera shake if active
 	if (bBonusCameraShaking)
@@ -4924,7 +5656,7 @@ void ADiceGameManager::CleanupBonusRound()
 		ADiceCamera* Cam = FindCamera();
 		if (Cam)
 		{
-			Cam->SetActorLocation(Cam->GetActorLocation() - BonusCameraShakeOffset);
+			Cam->ClearOffsetLayer(ECameraOffset::BonusShake);
 		}
 		bBonusCameraShaking = false;
 		BonusCameraShakeOffset = FVector::ZeroVector;
@@ -4969,6 +5701,7 @@ void ADiceGameManager::StartMasqueradeTypewriter()
 	if (!MasqueradeUIText)
 	{
 		MasqueradeUIText = MasqueradeUIActor->FindComponentByClass<UTextRenderComponent>();
+		UDiceLabelBatcher::Adopt(MasqueradeUIText);
 	}
 
 	if (!MasqueradeUIText)
@@ -4976,158 +5709,118 @@ void ADiceGameManager::StartMasqueradeTypewriter()
 		return;
 	}
 
-	// Store the full text from the component's current text
-	MasqueradeFullText = MasqueradeUIText->Text.ToString();
-	MasqueradeCurrentText = TEXT("");
-	TypewriterTimer = 0.0f;
-	TypewriterIndex = 0;
-	GlitchTimer = 0.0f;
-	bShowingGlitch = false;
-	bTypewriterActive = true;
-	bTypewriterOut = false;  // Typing IN
+	if (!MasqueradeReveal)
+	{
+		// Store the full text from the component's authored text
+		MasqueradeFullText = MasqueradeUIText->Text.ToString();
+
+		MasqueradeReveal = UDiceTextRevealComponent::FindOrCreate(MasqueradeUIActor, MasqueradeUIText);
+		if (!MasqueradeReveal)
+		{
+			return;
+		}
+		MasqueradeReveal->Mode = ETextRevealMode::Typewriter;
+		MasqueradeReveal->OnRevealFinished.AddUObject(this, &ADiceGameManager::HandleMasqueradeRevealFinished);
+	}
+
+	MasqueradeReveal->CharsPerSecond = TypewriterSpeed * 1.5f;
+	MasqueradeReveal->GlitchChance = GlitchChance;
 
-	// Show the actor and clear the text
+	// Show the actor - the reveal starts from a blank label
 	MasqueradeUIActor->SetActorHiddenInGame(false);
-	MasqueradeUIText->SetText(FText::FromString(TEXT("")));
+	MasqueradeReveal->RevealIn(MasqueradeFullText);
 
-	UE_LOG(LogTemp, Warning, TEXT("Starting Masquerade typewriter IN: %s"), *MasqueradeFullText);
+	UE_LOG(LogDiceGame, Log, TEXT("Starting Masquerade typewriter IN: %s"), *MasqueradeFullText);
 }
 
 void ADiceGameManager::StartMasqueradeTypewriterOut()
 {
-	if (!MasqueradeUIActor || !MasqueradeUIText)
+	if (!MasqueradeUIActor || !MasqueradeReveal)
 	{
 		return;
 	}
 
 	// If already typing out or not active, just hide
-	if (bTypewriterOut || MasqueradeCurrentText.Len() == 0)
+	if (MasqueradeReveal->IsTypingOut() || MasqueradeReveal->GetVisibleCount() == 0)
 	{
 		HideMasqueradeUI();
 		return;
 	}
 
 	// Start typing out from current text
-	TypewriterTimer = 0.0f;
-	TypewriterIndex = MasqueradeCurrentText.Len();
-	GlitchTimer = 0.0f;
-	bShowingGlitch = false;
-	bTypewriterActive = true;
-	bTypewriterOut = true;  // Typing OUT
+	MasqueradeReveal->GlitchChance = GlitchChance;
+	MasqueradeReveal->RevealOut();
 
-	UE_LOG(LogTemp, Warning, TEXT("Starting Masquerade typewriter OUT"));
+	UE_LOG(LogDiceGame, Log, TEXT("Starting Masquerade typewriter OUT"));
 }
 
-void ADiceGameManager::UpdateMasqueradeTypewriter(float DeltaTime)
+void ADiceGameManager::HandleMasqueradeRevealFinished(bool bTypedOut)
 {
-	if (!bTypewriterActive || !MasqueradeUIText)
+	// Typewriter out complete
+	if (bTypedOut)
 	{
-		return;
+		HideMasqueradeUI();
 	}
+}
 
-	TypewriterTimer += DeltaTime;
-	float CharInterval = 1.0f / (TypewriterSpeed * 1.5f);  // Faster for out effect
+// ==================== WIN SEQUENCE ====================
 
-	// Handle glitch effect
-	if (bShowingGlitch)
+namespace DiceSequence
+{
+	// Timeline track and event names shared by the win and lose sequences
+	const FName ModifierFade(TEXT("ModifierFade"));
+	const FName MaskTravel(TEXT("MaskTravel"));
+	const FName MaskScale(TEXT("MaskScale"));
+	const FName MaskFloat(TEXT("MaskFloat"));
+	const FName MaskWobble(TEXT("MaskWobble"));
+	const FName Mask(TEXT("Mask"));
+	const FName CameraPan(TEXT("CameraPan"));
+	const FName CameraOffset(TEXT("CameraOffset"));
+	const FName Fade(TEXT("Fade"));
+	const FName HideModifiers(TEXT("HideModifiers"));
+	const FName DropMask(TEXT("DropMask"));
+}
+
+UDiceTimelineAsset* ADiceGameManager::GetWinTimeline()
+{
+	if (WinTimeline)
 	{
-		GlitchTimer += DeltaTime;
-		if (GlitchTimer > 0.04f)  // Glitch duration
-		{
-			bShowingGlitch = false;
-			GlitchTimer = 0.0f;
-			MasqueradeUIText->SetText(FText::FromString(MasqueradeCurrentText));
-		}
-		else
-		{
-			// Show glitchy text
-			if (MasqueradeCurrentText.Len() > 0)
-			{
-				FString GlitchText = MasqueradeCurrentText;
-				int32 GlitchPos = FMath::RandRange(0, FMath::Max(0, GlitchText.Len() - 1));
-				int32 GlitchCharIdx = FMath::RandRange(0, GlitchChars.Len() - 1);
-				GlitchText[GlitchPos] = GlitchChars[GlitchCharIdx];
-				// Randomly add extra glitch chars
-				if (FMath::FRand() < 0.3f)
-				{
-					GlitchText.AppendChar(GlitchChars[FMath::RandRange(0, GlitchChars.Len() - 1)]);
-				}
-				MasqueradeUIText->SetText(FText::FromString(GlitchText));
-			}
-		}
-		return;
+		return WinTimeline;
 	}
 
-	if (TypewriterTimer >= CharInterval)
+	if (!DefaultWinTimeline)
 	{
-		TypewriterTimer = 0.0f;
-
-		if (bTypewriterOut)
-		{
-			// TYPING OUT - remove characters
-			if (MasqueradeCurrentText.Len() > 0)
-			{
-				MasqueradeCurrentText = MasqueradeCurrentText.Left(MasqueradeCurrentText.Len() - 1);
-				TypewriterIndex = MasqueradeCurrentText.Len();
-
-				// Chance to trigger glitch effect
-				if (FMath::FRand() < GlitchChance * 1.5f)  // More glitchy when typing out
-				{
-					bShowingGlitch = true;
-					GlitchTimer = 0.0f;
-				}
-				else
-				{
-					MasqueradeUIText->SetText(FText::FromString(MasqueradeCurrentText));
-				}
-
-				// Typewriter out complete
-				if (MasqueradeCurrentText.Len() == 0)
-				{
-					bTypewriterActive = false;
-					HideMasqueradeUI();
-				}
-			}
-		}
-		else
-		{
-			// TYPING IN - add characters
-			if (TypewriterIndex < MasqueradeFullText.Len())
-			{
-				MasqueradeCurrentText.AppendChar(MasqueradeFullText[TypewriterIndex]);
-				TypewriterIndex++;
-
-				// Chance to trigger glitch effect
-				if (FMath::FRand() < GlitchChance)
-				{
-					bShowingGlitch = true;
-					GlitchTimer = 0.0f;
-				}
-				else
-				{
-					MasqueradeUIText->SetText(FText::FromString(MasqueradeCurrentText));
-				}
+		// Built-in timing: modifiers fade over ~0.7s, then the mask floats in over 6s and the screen fades over its last 30%
+		const float FloatStart = 1.2f;
+		const float FloatEnd = FloatStart + 6.0f;
+		const float FadeStart = FloatStart + 6.0f * 0.7f;
 
-				// Typewriter in complete
-				if (TypewriterIndex >= MasqueradeFullText.Len())
-				{
-					bTypewriterActive = false;
-					MasqueradeUIText->SetText(FText::FromString(MasqueradeFullText));
-				}
-			}
-		}
+		DefaultWinTimeline = NewObject<UDiceTimelineAsset>(this, NAME_None, RF_Transient);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::ModifierFade, 0.0f, 1.0f);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::ModifierFade, 1.0f / 1.5f, 0.0f);
+		DefaultWinTimeline->AddEvent(FloatStart, DiceSequence::HideModifiers);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskTravel, FloatStart, 0.0f);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskTravel, FloatEnd, 1.0f, EDiceTimelineEase::EaseInOutCubic);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskScale, FloatStart, 1.0f);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskScale, FloatEnd, 1.3f, EDiceTimelineEase::EaseInOutCubic);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskFloat, FloatStart, 1.0f);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskFloat, FloatEnd, 0.3f, EDiceTimelineEase::EaseInOutCubic);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskWobble, FloatStart, 1.0f);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::MaskWobble, FloatEnd, 0.2f, EDiceTimelineEase::EaseInOutCubic);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::Fade, FadeStart, 0.0f);
+		DefaultWinTimeline->AddFloatKey(DiceSequence::Fade, FloatEnd, 1.0f, EDiceTimelineEase::EaseInQuad);
 	}
+	return DefaultWinTimeline;
 }
 
-// ==================== WIN SEQUENCE ====================
-
 void ADiceGameManager::StartWinSequence()
 {
+	SCOPE_CYCLE_COUNTER(STAT_DiceSequenceStart);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	WinSequencePhase = 1;  // Start with modifier fade
-	WinSequenceTimer = 0.0f;
-	WinSequenceProgress = 0.0f;
-	WinMaskRotationProgress = 0.0f;
-	WinFadeAlpha = 0.0f;
+	WinMaskFloatStartTime = 0.0f;
+	WinTimelinePlayer.Play(GetWinTimeline());
 
 	// Store mask MESH starting position (we move the mesh, not the actor)
 	AMaskEnemy* Enemy = FindEnemy();
@@ -5142,7 +5835,7 @@ void ADiceGameManager::StartWinSequence()
 		WinMaskMeshTargetPos = FVector(652.0f, WinMaskMeshStartPos.Y, 215.0f);
 		WinMaskMeshTargetRot = FRotator(0.0f, 270.0f, 0.0f);  // Rotates from ~90 to ~270 (180 degree turn)
 
-		UE_LOG(LogTemp, Warning, TEXT("WIN: Mask start pos: %s, target pos: %s"),
+		UE_LOG(LogDiceGame, Log, TEXT("WIN: Mask start pos: %s, target pos: %s"),
 			*WinMaskMeshStartPos.ToString(), *WinMaskMeshTargetPos.ToString());
 	}
 
@@ -5152,15 +5845,6 @@ void ADiceGameManager::StartWinSequence()
 	{
 		bWinCameraBreathing = true;
 		WinCameraBreathTimer = 0.0f;
-		WinCameraBasePos = Cam->GetActorLocation();
-		WinCameraBaseRot = Cam->GetActorRotation();
-	}
-
-	// Initialize modifier fade alphas
-	ModifierFadeAlpha.Empty();
-	for (int32 i = 0; i < AllModifiers.Num(); i++)
-	{
-		ModifierFadeAlpha.Add(1.0f);  // Start fully visible
 	}
 
 	// Update timer text to show victory
@@ -5202,14 +5886,15 @@ void ADiceGameManager::StartWinSequence()
 	// Play victory sound
 	if (SoundManager) SoundManager->PlayDiceMatch();
 
-	UE_LOG(LogTemp, Warning, TEXT("WIN SEQUENCE STARTED!"));
+	UE_LOG(LogDiceGame, Log, TEXT("WIN SEQUENCE STARTED!"));
+	ArmSequenceHitchCapture(TEXT("WIN"), StartCycles);
 }
 
 void ADiceGameManager::UpdateWinSequence(float DeltaTime)
 {
 	if (WinSequencePhase == 0) return;
 
-	WinSequenceTimer += DeltaTime;
+	ReportSequenceHitch();
 
 	// Update win camera breathing while sequence is active
 	if (bWinCameraBreathing)
@@ -5233,225 +5918,180 @@ void ADiceGameManager::UpdateWinSequence(float DeltaTime)
 			float ForwardBreath = FMath::Sin(WinCameraBreathTimer * BreathSpeed * 0.7f) * 3.0f;
 			BreathOffset.X = ForwardBreath;
 
-			Cam->SetActorLocation(WinCameraBasePos + BreathOffset);
-
 			// Subtle rotation shake
-			FRotator BreathRot = WinCameraBaseRot;
-			BreathRot.Pitch += FMath::Sin(WinCameraBreathTimer * BreathSpeed * 0.8f) * 1.5f;
-			BreathRot.Roll += FMath::Sin(WinCameraBreathTimer * BreathSpeed * 1.1f) * 0.8f;
-			Cam->SetActorRotation(BreathRot);
+			FRotator BreathRot = FRotator::ZeroRotator;
+			BreathRot.Pitch = FMath::Sin(WinCameraBreathTimer * BreathSpeed * 0.8f) * 1.5f;
+			BreathRot.Roll = FMath::Sin(WinCameraBreathTimer * BreathSpeed * 1.1f) * 0.8f;
+			Cam->SetOffsetLayer(ECameraOffset::SequenceBreath, BreathOffset, BreathRot);
 		}
 	}
 
-	switch (WinSequencePhase)
+	if (WinSequencePhase == 3)
 	{
-		case 1:  // Modifiers fade out (or wait if no modifiers)
-		{
-			UpdateModifierFade(DeltaTime);
-
-			// Check if all modifiers faded - require at least 1 second even if no modifiers
-			bool bAllFaded = true;
-			for (float Alpha : ModifierFadeAlpha)
-			{
-				if (Alpha > 0.01f)
-				{
-					bAllFaded = false;
-					break;
-				}
-			}
-
-			// Wait minimum 1.5 seconds before moving to mask float phase
-			if ((bAllFaded && WinSequenceTimer >= 1.0f) || WinSequenceTimer >= 2.0f)
-			{
-				// Hide all modifiers
-				for (ADiceModifier* Mod : AllModifiers)
-				{
-					if (Mod) Mod->SetHidden(true);
-				}
+		return;  // Done - wait for player input
+	}
 
-				WinSequencePhase = 2;
-				WinSequenceTimer = 0.0f;
-				WinSequenceProgress = 0.0f;
-				WinFadeAlpha = 0.0f;  // Ensure fade starts at 0
+	WinTimelinePlayer.Advance(DeltaTime, [this](FName Event) { HandleWinTimelineEvent(Event); });
 
-				// Play victory sound
-				if (SoundManager) SoundManager->PlayDiceMatch();
+	if (WinSequencePhase == 1)
+	{
+		UpdateModifierFade();
+	}
+	else if (WinSequencePhase == 2)
+	{
+		UpdateMaskFloat();
+	}
 
-				UE_LOG(LogTemp, Warning, TEXT("WIN: Moving to mask float phase"));
-			}
-			break;
-		}
+	// Fade to black runs off its own track, alongside whichever phase is playing
+	SetScreenFade(WinTimelinePlayer.EvaluateFloat(DiceSequence::Fade, 0.0f));
 
-		case 2:  // Mask floats toward camera + rotates + screen fades (all simultaneous)
+	if (WinTimelinePlayer.IsFinished())
+	{
+		WinSequencePhase = 3;
+		WinTimelinePlayer.Stop();
+		bWinCameraBreathing = false;  // Stop breathing
+		if (ADiceCamera* Cam = FindCamera())
 		{
-			UpdateMaskFloat(DeltaTime);
-
-			// When mask is close enough and faded, finish
-			if (WinSequenceProgress >= 1.0f && WinFadeAlpha >= 0.95f)
-			{
-				WinSequencePhase = 3;
-				WinSequenceTimer = 0.0f;
-				bWinCameraBreathing = false;  // Stop breathing
-				OnWinSequenceComplete();
-			}
-			break;
+			Cam->ClearOffsetLayer(ECameraOffset::SequenceBreath);
 		}
+		OnWinSequenceComplete();
+	}
+}
 
-		case 3:  // Done - wait for player input
+void ADiceGameManager::HandleWinTimelineEvent(FName Event)
+{
+	if (Event == DiceSequence::HideModifiers && WinSequencePhase == 1)
+	{
+		// Hide all modifiers
+		for (ADiceModifier* Mod : AllModifiers)
 		{
-			// Could add "Press any key" logic here
-			break;
+			if (Mod) Mod->SetHidden(true);
 		}
+
+		WinSequencePhase = 2;
+		WinMaskFloatStartTime = WinTimelinePlayer.GetTime();
+
+		// Play victory sound
+		if (SoundManager) SoundManager->PlayDiceMatch();
+
+		UE_LOG(LogDiceGame, Log, TEXT("WIN: Moving to mask float phase"));
 	}
 }
 
-void ADiceGameManager::UpdateModifierFade(float DeltaTime)
+void ADiceGameManager::UpdateModifierFade()
 {
-	float FadeSpeed = 1.5f;
+	// Each modifier starts its fade this long after the previous one
+	const float Stagger = 0.1f;
+	const float Now = WinTimelinePlayer.GetTime();
 
 	for (int32 i = 0; i < AllModifiers.Num(); i++)
 	{
-		if (AllModifiers[i] && ModifierFadeAlpha.IsValidIndex(i))
+		const float Delay = i * Stagger;
+		if (!AllModifiers[i] || !AllModifiers[i]->ModifierText || Now <= Delay)
 		{
-			// Stagger the fade based on index
-			float Delay = i * 0.1f;
-			if (WinSequenceTimer > Delay)
-			{
-				ModifierFadeAlpha[i] = FMath::Max(0.0f, ModifierFadeAlpha[i] - DeltaTime * FadeSpeed);
-
-				// Apply fade to modifier text
-				if (AllModifiers[i]->ModifierText)
-				{
-					uint8 Alpha = static_cast<uint8>(ModifierFadeAlpha[i] * 255.0f);
-					FColor CurrentColor = AllModifiers[i]->ModifierText->TextRenderColor;
-					CurrentColor.A = Alpha;
-					AllModifiers[i]->ModifierText->SetTextRenderColor(CurrentColor);
-				}
-			}
+			continue;
 		}
+
+		// Apply fade to modifier text
+		const float FadeAlpha = FMath::Clamp(WinTimelinePlayer.EvaluateFloatAt(DiceSequence::ModifierFade, Now - Delay, 0.0f), 0.0f, 1.0f);
+		FColor CurrentColor = AllModifiers[i]->ModifierText->TextRenderColor;
+		CurrentColor.A = static_cast<uint8>(FadeAlpha * 255.0f);
+		UDiceLabelBatcher::SetColor(AllModifiers[i]->ModifierText, CurrentColor);
 	}
 }
 
-void ADiceGameManager::UpdateMaskFloat(float DeltaTime)
+void ADiceGameManager::UpdateMaskFloat()
 {
 	AMaskEnemy* Enemy = FindEnemy();
 	if (!Enemy || !Enemy->Mesh) return;
 
-	float FloatDuration = 6.0f;  // Total time for mask to reach player (slow and dramatic)
-	WinSequenceProgress = FMath::Min(WinSequenceProgress + DeltaTime / FloatDuration, 1.0f);
+	const float FloatTime = WinTimelinePlayer.GetTime() - WinMaskFloatStartTime;
 
-	// Smooth easing - ease in-out (slow start, slow end)
-	float EasedProgress;
-	if (WinSequenceProgress < 0.5f)
-	{
-		// Ease in (slow start)
-		EasedProgress = 4.0f * WinSequenceProgress * WinSequenceProgress * WinSequenceProgress;
-	}
-	else
+	// A keyed "Mask" track wins; otherwise travel from the start pose toward the player
+	FVector NewRelativePos;
+	FRotator NewRot;
+	FVector NewScale;
+	if (!WinTimelinePlayer.EvaluateTransform(DiceSequence::Mask, NewRelativePos, NewRot, NewScale))
 	{
-		// Ease out (slow end)
-		EasedProgress = 1.0f - FMath::Pow(-2.0f * WinSequenceProgress + 2.0f, 3.0f) / 2.0f;
-	}
+		const float Travel = WinTimelinePlayer.EvaluateFloat(DiceSequence::MaskTravel, 0.0f);
+		NewRelativePos = FMath::Lerp(WinMaskMeshStartPos, WinMaskMeshTargetPos, Travel);
+		NewRot = FMath::Lerp(WinMaskMeshStartRot, WinMaskMeshTargetRot, Travel);
 
-	// Smoothly interpolate relative position
-	FVector NewRelativePos = FMath::Lerp(WinMaskMeshStartPos, WinMaskMeshTargetPos, EasedProgress);
+		// Scale up slightly as it approaches (subtle)
+		const float BaseScale = 0.25f;  // Original scale from your data
+		NewScale = FVector(BaseScale * WinTimelinePlayer.EvaluateFloat(DiceSequence::MaskScale, 1.0f));
+	}
 
 	// Add eerie floating motion (decreases as it gets closer)
-	float FloatIntensity = 1.0f - EasedProgress * 0.7f;  // Still some float at the end
-	float FloatOffset = FMath::Sin(WinSequenceTimer * 1.5f) * 10.0f * FloatIntensity;
-	float SideFloat = FMath::Sin(WinSequenceTimer * 0.9f) * 6.0f * FloatIntensity;
-	NewRelativePos.Z += FloatOffset;
-	NewRelativePos.Y += SideFloat;
-
-	Enemy->Mesh->SetRelativeLocation(NewRelativePos);
-
-	// Smoothly interpolate rotation (from start yaw to target yaw)
-	WinMaskRotationProgress = EasedProgress;
-	FRotator NewRot = FMath::Lerp(WinMaskMeshStartRot, WinMaskMeshTargetRot, EasedProgress);
+	const float FloatIntensity = WinTimelinePlayer.EvaluateFloat(DiceSequence::MaskFloat, 0.0f);
+	NewRelativePos.Z += FMath::Sin(FloatTime * 1.5f) * 10.0f * FloatIntensity;
+	NewRelativePos.Y += FMath::Sin(FloatTime * 0.9f) * 6.0f * FloatIntensity;
 
 	// Add creepy wobble that decreases as it gets closer
-	float WobbleIntensity = 1.0f - EasedProgress * 0.8f;
-	NewRot.Pitch += FMath::Sin(WinSequenceTimer * 2.0f) * 8.0f * WobbleIntensity;
-	NewRot.Roll += FMath::Sin(WinSequenceTimer * 1.7f) * 6.0f * WobbleIntensity;
-
-	Enemy->Mesh->SetRelativeRotation(NewRot);
+	const float WobbleIntensity = WinTimelinePlayer.EvaluateFloat(DiceSequence::MaskWobble, 0.0f);
+	NewRot.Pitch += FMath::Sin(FloatTime * 2.0f) * 8.0f * WobbleIntensity;
+	NewRot.Roll += FMath::Sin(FloatTime * 1.7f) * 6.0f * WobbleIntensity;
 
-	// Scale up slightly as it approaches (subtle)
-	float BaseScale = 0.25f;  // Original scale from your data
-	float ScaleMultiplier = BaseScale * (1.0f + EasedProgress * 0.3f);
-	Enemy->Mesh->SetRelativeScale3D(FVector(ScaleMultiplier));
+	Enemy->Mesh->SetRelativeLocationAndRotation(NewRelativePos, NewRot);
+	Enemy->Mesh->SetRelativeScale3D(NewScale);
+}
 
-	// === FADE TO BLACK SIMULTANEOUSLY ===
-	// Start fading at 70% progress (mask is close to camera), finish by 100%
-	float FadeStart = 0.7f;
-	if (WinSequenceProgress >= FadeStart)
+void ADiceGameManager::SetScreenFade(float Alpha)
+{
+	Alpha = FMath::Clamp(Alpha, 0.0f, 1.0f);
+	if (!FadeWidgetInstance)
 	{
-		// Add widget to viewport when fade actually starts (first time only)
-		if (FadeWidgetInstance && !FadeWidgetInstance->IsInViewport())
-		{
-			FadeWidgetInstance->AddToViewport(100);
-			UE_LOG(LogTemp, Warning, TEXT("WIN: Adding fade widget to viewport now"));
-		}
+		return;
+	}
 
-		float FadeProgress = (WinSequenceProgress - FadeStart) / (1.0f - FadeStart);
-		// Ease the fade - smooth
-		float EasedFade = FadeProgress * FadeProgress;  // Ease in (slow start, fast end)
-		WinFadeAlpha = FMath::Min(EasedFade, 1.0f);
+	const bool bShown = FadeWidgetInstance->IsInViewport() && FadeWidgetInstance->GetVisibility() != ESlateVisibility::Collapsed;
+	if (Alpha <= 0.0f && !bShown)
+	{
+		return;
+	}
 
-		// Update the black image widget opacity
-		if (BlackImageWidget)
+	// Show the widget when fade actually starts (first time only)
+	if (!bShown)
+	{
+		if (!FadeWidgetInstance->IsInViewport())
 		{
-			BlackImageWidget->SetRenderOpacity(WinFadeAlpha);
-			BlackImageWidget->SetColorAndOpacity(FLinearColor(0.0f, 0.0f, 0.0f, WinFadeAlpha));
+			FadeWidgetInstance->AddToViewport(100);
 		}
+		FadeWidgetInstance->SetVisibility(ESlateVisibility::HitTestInvisible);
+		UE_LOG(LogDiceGame, Log, TEXT("Showing fade widget now"));
 	}
-}
-
-void ADiceGameManager::UpdateScreenFade(float DeltaTime)
-{
-	float FadeSpeed = 1.5f;  // Time to fully fade
-	WinFadeAlpha = FMath::Min(WinFadeAlpha + DeltaTime / FadeSpeed, 1.0f);
 
 	// Update the black image widget opacity
 	if (BlackImageWidget)
 	{
-		FLinearColor FadeColor = FLinearColor(0.0f, 0.0f, 0.0f, WinFadeAlpha);
-		BlackImageWidget->SetColorAndOpacity(FadeColor);
+		BlackImageWidget->SetRenderOpacity(Alpha);
+		BlackImageWidget->SetColorAndOpacity(FLinearColor(0.0f, 0.0f, 0.0f, Alpha));
 	}
+}
 
-	// Update timer text during fade
-	URoundTimerComponent* Timer = GetRoundTimer();
-	if (Timer)
+void ADiceGameManager::CreateFadeWidget()
+{
+	// Already made during warm-up - just make sure it starts clear
+	if (FadeWidgetInstance)
 	{
-		// Find the text component in the timer's owner
-		AActor* TimerOwner = Timer->GetOwner();
-		if (TimerOwner)
+		if (BlackImageWidget)
 		{
-			UTextRenderComponent* TimerText = TimerOwner->FindComponentByClass<UTextRenderComponent>();
-			if (TimerText)
-			{
-				// Pulse the "VICTORY" text
-				float Pulse = (FMath::Sin(WinSequenceTimer * 4.0f) + 1.0f) * 0.5f;
-				uint8 Green = static_cast<uint8>(180 + Pulse * 75);
-				TimerText->SetText(FText::FromString(TEXT("VICTORY")));
-				TimerText->SetTextRenderColor(FColor(100, Green, 100, 255));
-			}
+			BlackImageWidget->SetColorAndOpacity(FLinearColor(0.0f, 0.0f, 0.0f, 0.0f));
+			BlackImageWidget->SetRenderOpacity(0.0f);
 		}
+		return;
 	}
-}
 
-void ADiceGameManager::CreateFadeWidget()
-{
 	if (!FadeWidgetClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FadeWidgetClass not set - screen fade will not work"));
+		UE_LOG(LogDiceGame, Warning, TEXT("FadeWidgetClass not set - screen fade will not work"));
 		return;
 	}
 
 	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
 	if (!PC) return;
 
-	// Create the widget but DON'T add to viewport yet
+	// Create the widget and park it collapsed in the viewport - the fade only has to make it visible
 	FadeWidgetInstance = CreateWidget<UUserWidget>(PC, FadeWidgetClass);
 	if (FadeWidgetInstance)
 	{
@@ -5468,18 +6108,21 @@ void ADiceGameManager::CreateFadeWidget()
 			// Start fully transparent
 			BlackImageWidget->SetColorAndOpacity(FLinearColor(0.0f, 0.0f, 0.0f, 0.0f));
 			BlackImageWidget->SetRenderOpacity(0.0f);
-			UE_LOG(LogTemp, Warning, TEXT("Fade widget created successfully (not added to viewport yet)"));
+			UE_LOG(LogDiceGame, Log, TEXT("Fade widget created successfully (collapsed in viewport)"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("BlackImage/ImageBlack not found in fade widget! Check widget design."));
+			UE_LOG(LogDiceGame, Warning, TEXT("BlackImage/ImageBlack not found in fade widget! Check widget design."));
 		}
+
+		FadeWidgetInstance->SetVisibility(ESlateVisibility::Collapsed);
+		FadeWidgetInstance->AddToViewport(100);
 	}
 }
 
 void ADiceGameManager::OnWinSequenceComplete()
 {
-	UE_LOG(LogTemp, Warning, TEXT("WIN SEQUENCE COMPLETE! Player has claimed the mask."));
+	UE_LOG(LogDiceGame, Log, TEXT("WIN SEQUENCE COMPLETE! Player has claimed the mask."));
 
 	// Hide the mask
 	AMaskEnemy* Enemy = FindEnemy();
@@ -5493,17 +6136,14 @@ void ADiceGameManager::OnWinSequenceComplete()
 
 void ADiceGameManager::HideMasqueradeUI()
 {
-	bTypewriterActive = false;
-	bTypewriterOut = false;
-
 	if (MasqueradeUIActor)
 	{
 		MasqueradeUIActor->SetActorHiddenInGame(true);
 	}
 
-	if (MasqueradeUIText)
+	if (MasqueradeReveal)
 	{
-		MasqueradeUIText->SetText(FText::FromString(TEXT("")));
+		MasqueradeReveal->Clear();
 	}
 }
 
@@ -5520,143 +6160,121 @@ void ADiceGameManager::StartDiceLabelTypewriter()
 	if (!DiceLabelTextComp)
 	{
 		DiceLabelTextComp = DiceLabelActor->FindComponentByClass<UTextRenderComponent>();
+		UDiceLabelBatcher::Adopt(DiceLabelTextComp);
 	}
 
-	if (!DiceLabelTextComp)
+	if (!DiceLabelReveal)
 	{
-		return;
+		DiceLabelReveal = UDiceTextRevealComponent::FindOrCreate(DiceLabelActor, DiceLabelTextComp);
+		if (!DiceLabelReveal)
+		{
+			return;
+		}
+		DiceLabelReveal->Mode = ETextRevealMode::Typewriter;
+		DiceLabelReveal->OnRevealFinished.AddUObject(this, &ADiceGameManager::HandleDiceLabelRevealFinished);
 	}
 
-	// Use the configurable label text
-	DiceLabelFullText = DiceLabelText;
-	DiceLabelCurrentText = TEXT("");
-	DiceLabelTypeTimer = 0.0f;
-	DiceLabelTypeIndex = 0;
-	bDiceLabelTypewriterActive = true;
-	bDiceLabelTypewriterOut = false;  // Typing IN
+	DiceLabelReveal->CharsPerSecond = DiceLabelTypeSpeed;
 
-	// Show the actor and clear the text
+	// Show the actor and type in the configurable label text
 	DiceLabelActor->SetActorHiddenInGame(false);
-	DiceLabelTextComp->SetText(FText::FromString(TEXT("")));
+	DiceLabelReveal->RevealIn(DiceLabelText);
 
-	UE_LOG(LogTemp, Warning, TEXT("Starting DiceLabel typewriter IN: %s"), *DiceLabelFullText);
+	UE_LOG(LogDiceGame, Log, TEXT("Starting DiceLabel typewriter IN: %s"), *DiceLabelText);
 }
 
 void ADiceGameManager::StartDiceLabelTypewriterOut()
 {
-	if (!DiceLabelActor || !DiceLabelTextComp)
+	if (!DiceLabelActor || !DiceLabelReveal)
 	{
 		return;
 	}
 
 	// If already typing out or not active, just hide
-	if (bDiceLabelTypewriterOut || DiceLabelCurrentText.Len() == 0)
+	if (DiceLabelReveal->IsTypingOut() || DiceLabelReveal->GetVisibleCount() == 0)
 	{
 		HideDiceLabel();
 		return;
 	}
 
 	// Start typing OUT (reverse)
-	DiceLabelTypeIndex = DiceLabelCurrentText.Len();
-	DiceLabelTypeTimer = 0.0f;
-	bDiceLabelTypewriterOut = true;
-	bDiceLabelTypewriterActive = true;
+	DiceLabelReveal->RevealOut();
 
-	UE_LOG(LogTemp, Warning, TEXT("Starting DiceLabel typewriter OUT"));
+	UE_LOG(LogDiceGame, Log, TEXT("Starting DiceLabel typewriter OUT"));
 }
 
-void ADiceGameManager::UpdateDiceLabelTypewriter(float DeltaTime)
+void ADiceGameManager::HandleDiceLabelRevealFinished(bool bTypedOut)
 {
-	if (!bDiceLabelTypewriterActive || !DiceLabelTextComp)
+	// Done typing out - typed in text stays visible
+	if (bTypedOut)
 	{
-		return;
+		HideDiceLabel();
 	}
+}
 
-	DiceLabelTypeTimer += DeltaTime;
-
-	float CharTime = 1.0f / DiceLabelTypeSpeed;
-
-	if (bDiceLabelTypewriterOut)
+void ADiceGameManager::HideDiceLabel()
+{
+	if (DiceLabelActor)
 	{
-		// Typing OUT - remove characters
-		if (DiceLabelTypeTimer >= CharTime)
-		{
-			DiceLabelTypeTimer = 0.0f;
+		DiceLabelActor->SetActorHiddenInGame(true);
+	}
 
-			if (DiceLabelTypeIndex > 0)
-			{
-				DiceLabelTypeIndex--;
-				DiceLabelCurrentText = DiceLabelFullText.Left(DiceLabelTypeIndex);
-				DiceLabelTextComp->SetText(FText::FromString(DiceLabelCurrentText));
-			}
-			else
-			{
-				// Done typing out
-				HideDiceLabel();
-			}
-		}
+	if (DiceLabelReveal)
+	{
+		DiceLabelReveal->Clear();
 	}
-	else
+	else if (DiceLabelTextComp)
 	{
-		// Typing IN - add characters
-		if (DiceLabelTypeTimer >= CharTime)
-		{
-			DiceLabelTypeTimer = 0.0f;
-
-			if (DiceLabelTypeIndex < DiceLabelFullText.Len())
-			{
-				DiceLabelTypeIndex++;
-				DiceLabelCurrentText = DiceLabelFullText.Left(DiceLabelTypeIndex);
-				DiceLabelTextComp->SetText(FText::FromString(DiceLabelCurrentText));
-			}
-			else
-			{
-				// Done typing in - keep visible
-				bDiceLabelTypewriterActive = false;
-			}
-		}
+		UDiceLabelBatcher::SetText(DiceLabelTextComp, FText::GetEmpty());
 	}
 }
 
-void ADiceGameManager::HideDiceLabel()
-{
-	bDiceLabelTypewriterActive = false;
-	bDiceLabelTypewriterOut = false;
+// ==================== LOSE SEQUENCE ====================
 
-	if (DiceLabelActor)
+UDiceTimelineAsset* ADiceGameManager::GetLoseTimeline()
+{
+	if (LoseTimeline)
 	{
-		DiceLabelActor->SetActorHiddenInGame(true);
+		return LoseTimeline;
 	}
 
-	if (DiceLabelTextComp)
+	if (!DefaultLoseTimeline)
 	{
-		DiceLabelTextComp->SetText(FText::FromString(TEXT("")));
+		// Built-in timing: 2s pan down, then the mask and knife drop for 2.5s with the screen fading over the last 70%
+		const float DropStart = 2.0f;
+		const float DropEnd = DropStart + 2.5f;
+		const float FadeStart = DropStart + 2.5f * 0.3f;
+
+		DefaultLoseTimeline = NewObject<UDiceTimelineAsset>(this, NAME_None, RF_Transient);
+		DefaultLoseTimeline->AddFloatKey(DiceSequence::CameraPan, 0.0f, 0.0f);
+		DefaultLoseTimeline->AddFloatKey(DiceSequence::CameraPan, DropStart, 1.0f, EDiceTimelineEase::EaseOutCubic);
+		DefaultLoseTimeline->AddEvent(DropStart, DiceSequence::DropMask);
+		DefaultLoseTimeline->AddFloatKey(DiceSequence::Fade, FadeStart, 0.0f);
+		DefaultLoseTimeline->AddFloatKey(DiceSequence::Fade, DropEnd, 1.0f, EDiceTimelineEase::EaseInQuad);
 	}
+	return DefaultLoseTimeline;
 }
 
-// ==================== LOSE SEQUENCE ====================
-
 void ADiceGameManager::StartLoseSequence()
 {
+	SCOPE_CYCLE_COUNTER(STAT_DiceSequenceStart);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
 	LoseSequencePhase = 1;  // Start with breathing + pan down
-	LoseSequenceTimer = 0.0f;
-	LoseSequenceProgress = 0.0f;
-	LoseFadeAlpha = 0.0f;
+	LoseTimelinePlayer.Play(GetLoseTimeline());
 
 	// Store camera start position
 	ADiceCamera* Cam = FindCamera();
 	if (Cam)
 	{
-		LoseCameraStartPos = Cam->GetActorLocation();
-		LoseCameraStartRot = Cam->GetActorRotation();
+		Cam->GetViewPose(LoseCameraStartPos, LoseCameraStartRot);
 
 		// Move camera forward if offset is set
 		if (LoseCameraForwardOffset != 0.0f)
 		{
-			FVector ForwardOffset = Cam->GetActorForwardVector() * LoseCameraForwardOffset;
-			LoseCameraStartPos += ForwardOffset;
-			Cam->SetActorLocation(LoseCameraStartPos);
+			LoseCameraStartPos += LoseCameraStartRot.Vector() * LoseCameraForwardOffset;
 		}
+		Cam->SetPoseLayer(ECameraLayer::Sequence, LoseCameraStartPos, LoseCameraStartRot);
 
 		// Target rotation - look down from where we are
 		LoseCameraTargetRot = LoseCameraStartRot;
@@ -5698,14 +6316,15 @@ void ADiceGameManager::StartLoseSequence()
 	// Create fade widget (starts invisible)
 	CreateFadeWidget();
 
-	UE_LOG(LogTemp, Warning, TEXT("LOSE SEQUENCE STARTED!"));
+	UE_LOG(LogDiceGame, Log, TEXT("LOSE SEQUENCE STARTED!"));
+	ArmSequenceHitchCapture(TEXT("LOSE"), StartCycles);
 }
 
 void ADiceGameManager::UpdateLoseSequence(float DeltaTime)
 {
 	if (LoseSequencePhase == 0) return;
 
-	LoseSequenceTimer += DeltaTime;
+	ReportSequenceHitch();
 
 	// Breathing effect during lose sequence (shaky, panicked)
 	if (bLoseCameraBreathing)
@@ -5723,97 +6342,110 @@ void ADiceGameManager::UpdateLoseSequence(float DeltaTime)
 			float Breath2 = FMath::Sin(LoseCameraBreathTimer * BreathSpeed * 1.5f) * (BreathIntensity * 0.3f);
 
 			FVector BreathOffset = FVector(0, 0, Breath1 + Breath2);
-			Cam->SetActorLocation(LoseCameraStartPos + BreathOffset);
+			Cam->SetOffsetLayer(ECameraOffset::SequenceBreath, BreathOffset);
 		}
 	}
 
-	switch (LoseSequencePhase)
+	if (LoseSequencePhase == 3)
 	{
-		case 1:  // Breathing + camera pan down
-		{
-			float PanDuration = 2.0f;
-			LoseSequenceProgress = FMath::Min(LoseSequenceProgress + DeltaTime / PanDuration, 1.0f);
+		return;  // Done
+	}
 
-			// Ease out for smooth pan
-			float EasedProgress = 1.0f - FMath::Pow(1.0f - LoseSequenceProgress, 3.0f);
+	LoseTimelinePlayer.Advance(DeltaTime, [this](FName Event) { HandleLoseTimelineEvent(Event); });
 
-			ADiceCamera* Cam = FindCamera();
-			if (Cam)
-			{
-				FRotator NewRot = FMath::Lerp(LoseCameraStartRot, LoseCameraTargetRot, EasedProgress);
-				// Add breathing shake
-				NewRot.Pitch += FMath::Sin(LoseCameraBreathTimer * 5.0f) * 2.0f;
-				NewRot.Roll += FMath::Sin(LoseCameraBreathTimer * 4.0f) * 1.0f;
-				Cam->SetActorRotation(NewRot);
-			}
-
-			if (LoseSequenceProgress >= 1.0f)
-			{
-				LoseSequencePhase = 2;
-				LoseSequenceTimer = 0.0f;
-				LoseSequenceProgress = 0.0f;
+	// Camera pan down
+	ADiceCamera* Cam = FindCamera();
+	if (Cam)
+	{
+		const float Pan = LoseTimelinePlayer.EvaluateFloat(DiceSequence::CameraPan, 0.0f);
+		FVector NewPos = LoseCameraStartPos;
+		FRotator NewRot = FMath::Lerp(LoseCameraStartRot, LoseCameraTargetRot, Pan);
 
-				// Spawn and drop player mask + knife
-				SpawnAndDropPlayerMask();
-				DropLastKnife();
-			}
-			break;
+		FVector OffsetPos;
+		FRotator OffsetRot;
+		FVector OffsetScale;
+		if (LoseTimelinePlayer.EvaluateTransform(DiceSequence::CameraOffset, OffsetPos, OffsetRot, OffsetScale))
+		{
+			NewPos += LoseCameraStartRot.RotateVector(OffsetPos);
+			NewRot += OffsetRot;
 		}
 
-		case 2:  // Mask drop + knife drop + start fade
+		// Add breathing shake
+		NewRot.Pitch += FMath::Sin(LoseCameraBreathTimer * 5.0f) * 2.0f;
+		NewRot.Roll += FMath::Sin(LoseCameraBreathTimer * 4.0f) * 1.0f;
+		Cam->SetPoseLayer(ECameraLayer::Sequence, NewPos, NewRot);
+	}
+
+	SetScreenFade(LoseTimelinePlayer.EvaluateFloat(DiceSequence::Fade, 0.0f));
+
+	if (LoseTimelinePlayer.IsFinished())
+	{
+		LoseSequencePhase = 3;
+		LoseTimelinePlayer.Stop();
+		bLoseCameraBreathing = false;
+		if (Cam)
 		{
-			float DropDuration = 2.5f;
-			LoseSequenceProgress = FMath::Min(LoseSequenceProgress + DeltaTime / DropDuration, 1.0f);
+			Cam->ClearOffsetLayer(ECameraOffset::SequenceBreath);
+		}
+		OnLoseSequenceComplete();
+	}
+}
 
-			// Start fading at 30%
-			if (LoseSequenceProgress >= 0.3f)
-			{
-				float FadeProgress = (LoseSequenceProgress - 0.3f) / 0.7f;
-				LoseFadeAlpha = FMath::Min(FadeProgress * FadeProgress, 1.0f);
+void ADiceGameManager::HandleLoseTimelineEvent(FName Event)
+{
+	if (Event == DiceSequence::DropMask && LoseSequencePhase == 1)
+	{
+		LoseSequencePhase = 2;
 
-				// Add widget to viewport when fade starts
-				if (FadeWidgetInstance && !FadeWidgetInstance->IsInViewport())
-				{
-					FadeWidgetInstance->AddToViewport(100);
-				}
+		// Spawn and drop player mask + knife
+		SpawnAndDropPlayerMask();
+		DropLastKnife();
+	}
+}
 
-				if (BlackImageWidget)
-				{
-					BlackImageWidget->SetRenderOpacity(LoseFadeAlpha);
-					BlackImageWidget->SetColorAndOpacity(FLinearColor(0.0f, 0.0f, 0.0f, LoseFadeAlpha));
-				}
-			}
+void ADiceGameManager::SpawnPlayerMaskActor()
+{
+	if (IsValid(PlayerMaskActor) || !PlayerMaskMesh)
+	{
+		return;
+	}
 
-			if (LoseSequenceProgress >= 1.0f && LoseFadeAlpha >= 0.95f)
-			{
-				LoseSequencePhase = 3;
-				LoseSequenceTimer = 0.0f;
-				bLoseCameraBreathing = false;
-				OnLoseSequenceComplete();
-			}
-			break;
-		}
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	PlayerMaskActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!PlayerMaskActor)
+	{
+		return;
+	}
 
-		case 3:  // Done
-		{
-			// Could add "Press any key to restart" logic here
-			break;
-		}
+	// Create static mesh component dynamically
+	DroppedPlayerMask = NewObject<UStaticMeshComponent>(PlayerMaskActor);
+	DroppedPlayerMask->SetMobility(EComponentMobility::Movable);
+	DroppedPlayerMask->SetStaticMesh(PlayerMaskMesh);
+	if (PlayerMaskMaterial)
+	{
+		DroppedPlayerMask->SetMaterial(0, PlayerMaskMaterial);
 	}
+	PlayerMaskActor->SetRootComponent(DroppedPlayerMask);
+	DroppedPlayerMask->RegisterComponent();
+
+	// Query-only with every channel ignored - the body exists up front but touches nothing until the drop
+	DroppedPlayerMask->SetCollisionResponseToAllChannels(ECR_Ignore);
+	DroppedPlayerMask->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	PlayerMaskActor->SetActorHiddenInGame(true);
 }
 
 void ADiceGameManager::SpawnAndDropPlayerMask()
 {
 	if (!PlayerMaskMesh)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("LOSE: PlayerMaskMesh not set!"));
+		UE_LOG(LogDiceGame, Warning, TEXT("LOSE: PlayerMaskMesh not set!"));
 		return;
 	}
 
 	ADiceCamera* Cam = FindCamera();
 	if (!Cam) return;
 
-	// Create a new actor to hold the dropping mask
 	FVector SpawnPos = Cam->GetActorLocation() + Cam->GetActorForwardVector() * 50.0f;
 	SpawnPos.Z += 30.0f;  // Start above camera view
 	PlayerMaskDropStartPos = SpawnPos;
@@ -5822,57 +6454,45 @@ void ADiceGameManager::SpawnAndDropPlayerMask()
 	FRotator FacingRot = PlayerMaskDropRotation;
 	FacingRot.Yaw += Cam->GetActorRotation().Yaw;
 
-	// Create static mesh component dynamically
-	AActor* MaskActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), SpawnPos, FacingRot);
-	if (MaskActor)
+	// Normally already spawned (hidden) by the warm-up
+	SpawnPlayerMaskActor();
+	if (!IsValid(PlayerMaskActor) || !DroppedPlayerMask)
 	{
-		DroppedPlayerMask = NewObject<UStaticMeshComponent>(MaskActor);
-		if (DroppedPlayerMask)
-		{
-			DroppedPlayerMask->SetStaticMesh(PlayerMaskMesh);
-			if (PlayerMaskMaterial)
-			{
-				DroppedPlayerMask->SetMaterial(0, PlayerMaskMaterial);
-			}
-			DroppedPlayerMask->RegisterComponent();
-			DroppedPlayerMask->AttachToComponent(MaskActor->GetRootComponent(), FAttachmentTransformRules::KeepWorldTransform);
-			MaskActor->SetRootComponent(DroppedPlayerMask);
+		return;
+	}
 
-			DroppedPlayerMask->SetWorldLocation(SpawnPos);
-			DroppedPlayerMask->SetWorldRotation(FacingRot);
-			DroppedPlayerMask->SetWorldScale3D(FVector(PlayerMaskDropScale));
+	DroppedPlayerMask->SetWorldLocationAndRotation(SpawnPos, FacingRot, false, nullptr, ETeleportType::TeleportPhysics);
+	DroppedPlayerMask->SetWorldScale3D(FVector(PlayerMaskDropScale));
+	DroppedPlayerMask->SetVisibility(true);  // May have been retired by the debris cap last time
+	PlayerMaskActor->SetActorHiddenInGame(false);
 
-			// Enable physics for rigid body drop
-			DroppedPlayerMask->SetSimulatePhysics(true);
-			DroppedPlayerMask->SetEnableGravity(true);
-			DroppedPlayerMask->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-			DroppedPlayerMask->SetCollisionResponseToAllChannels(ECR_Block);
+	// Enable physics for rigid body drop
+	DroppedPlayerMask->SetCollisionResponseToAllChannels(ECR_Block);
+	DroppedPlayerMask->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	DroppedPlayerMask->SetEnableGravity(true);
+	DroppedPlayerMask->SetSimulatePhysics(true);
 
-			// Add gentle tumble as it falls
-			DroppedPlayerMask->AddAngularImpulseInDegrees(FVector(
-				FMath::RandRange(-20.0f, 20.0f),
-				FMath::RandRange(-20.0f, 20.0f),
-				FMath::RandRange(-10.0f, 10.0f)
-			));
+	// Add gentle tumble as it falls
+	DroppedPlayerMask->AddAngularImpulseInDegrees(FVector(
+		FMath::RandRange(-20.0f, 20.0f),
+		FMath::RandRange(-20.0f, 20.0f),
+		FMath::RandRange(-10.0f, 10.0f)
+	));
 
-			UE_LOG(LogTemp, Warning, TEXT("LOSE: Player mask spawned and dropping"));
-		}
+	if (UDiceDebrisManager* Debris = UDiceDebrisManager::Get(this))
+	{
+		Debris->Track(DroppedPlayerMask);
 	}
+
+	UE_LOG(LogDiceGame, Log, TEXT("LOSE: Player mask dropping"));
 }
 
-void ADiceGameManager::DropLastKnife()
+UStaticMeshComponent* ADiceGameManager::FindSequenceKnife()
 {
 	// Get the player hand to find the knife
 	UPlayerHandComponent* PlayerHand = GetPlayerHand();
-	if (!PlayerHand)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("LOSE: No player hand for knife drop"));
-		return;
-	}
-
-	// Find the knife mesh in the hand actor
-	AActor* HandActor = PlayerHand->GetOwner();
-	if (!HandActor) return;
+	AActor* HandActor = PlayerHand ? PlayerHand->GetOwner() : nullptr;
+	if (!HandActor) return nullptr;
 
 	// Look for a static mesh component that might be the knife
 	TArray<UStaticMeshComponent*> MeshComps;
@@ -5882,39 +6502,133 @@ void ADiceGameManager::DropLastKnife()
 	{
 		if (Mesh && Mesh->GetName().Contains(TEXT("Knife")))
 		{
-			// Found the knife - enable physics
-			Mesh->SetSimulatePhysics(true);
-			Mesh->SetEnableGravity(true);
-			Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-			Mesh->SetCollisionResponseToAllChannels(ECR_Block);
-
-			// Add impulse to make it tumble
-			Mesh->AddImpulse(FVector(0, 0, -100.0f));
-			Mesh->AddAngularImpulseInDegrees(FVector(
-				FMath::RandRange(-100.0f, 100.0f),
-				FMath::RandRange(-100.0f, 100.0f),
-				FMath::RandRange(-50.0f, 50.0f)
-			));
-
-			DroppedKnife = Mesh;
-			UE_LOG(LogTemp, Warning, TEXT("LOSE: Knife dropping"));
-			break;
+			return Mesh;
 		}
 	}
+	return nullptr;
+}
+
+void ADiceGameManager::DropLastKnife()
+{
+	UStaticMeshComponent* Knife = IsValid(SequenceKnife) ? SequenceKnife : FindSequenceKnife();
+	if (!Knife)
+	{
+		UE_LOG(LogDiceGame, Warning, TEXT("LOSE: No knife on the player hand to drop"));
+		return;
+	}
+
+	// Found the knife - enable physics
+	Knife->SetCollisionResponseToAllChannels(ECR_Block);
+	Knife->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	Knife->SetEnableGravity(true);
+	Knife->SetSimulatePhysics(true);
+
+	// Add impulse to make it tumble
+	Knife->AddImpulse(FVector(0, 0, -100.0f));
+	Knife->AddAngularImpulseInDegrees(FVector(
+		FMath::RandRange(-100.0f, 100.0f),
+		FMath::RandRange(-100.0f, 100.0f),
+		FMath::RandRange(-50.0f, 50.0f)
+	));
+
+	if (UDiceDebrisManager* Debris = UDiceDebrisManager::Get(this))
+	{
+		Debris->Track(Knife);
+	}
+
+	DroppedKnife = Knife;
+	UE_LOG(LogDiceGame, Log, TEXT("LOSE: Knife dropping"));
 }
 
 void ADiceGameManager::OnLoseSequenceComplete()
 {
-	UE_LOG(LogTemp, Warning, TEXT("LOSE SEQUENCE COMPLETE! Game Over."));
+	UE_LOG(LogDiceGame, Log, TEXT("LOSE SEQUENCE COMPLETE! Game Over."));
 
-	// Clean up dropped mask
-	if (DroppedPlayerMask)
+	// Park the dropped mask again - it is kept for the next lose sequence
+	if (IsValid(PlayerMaskActor) && DroppedPlayerMask)
 	{
-		AActor* MaskOwner = DroppedPlayerMask->GetOwner();
-		if (MaskOwner)
+		if (UDiceDebrisManager* Debris = UDiceDebrisManager::Get(this))
 		{
-			MaskOwner->Destroy();
+			Debris->Untrack(DroppedPlayerMask);
 		}
-		DroppedPlayerMask = nullptr;
+		DroppedPlayerMask->SetSimulatePhysics(false);
+		DroppedPlayerMask->SetCollisionResponseToAllChannels(ECR_Ignore);
+		DroppedPlayerMask->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		PlayerMaskActor->SetActorHiddenInGame(true);
+	}
+}
+
+// ==================== SEQUENCE WARM-UP ====================
+
+void ADiceGameManager::WarmUpSequences()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Widget sits collapsed in the viewport, mask actor is spawned hidden with its mesh and material -
+	// registering them here also builds their render/physics state instead of at the dramatic moment
+	CreateFadeWidget();
+	SpawnPlayerMaskActor();
+
+	SequenceKnife = FindSequenceKnife();
+	if (SequenceKnife && SequenceKnife->GetCollisionEnabled() == ECollisionEnabled::NoCollision)
+	{
+		// Give the knife its physics body now (query-only, ignoring everything) so the drop only turns simulation on
+		SequenceKnife->SetCollisionResponseToAllChannels(ECR_Ignore);
+		SequenceKnife->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	}
+
+	// Build the timelines and get the sequence sounds decoded ahead of their first play
+	GetWinTimeline();
+	GetLoseTimeline();
+	if (SoundManager)
+	{
+		SoundManager->PrimeSounds();
+	}
+
+	UE_LOG(LogDiceGame, Log, TEXT("Sequence warm-up took %.2f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void ADiceGameManager::ArmSequenceHitchCapture(const TCHAR* Label, uint64 StartCycles)
+{
+	SequenceHitchLabel = Label;
+	SequenceStartMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	SequenceStartFrame = GFrameCounter;
+	bSequenceHitchPending = true;
+}
+
+void ADiceGameManager::ReportSequenceHitch()
+{
+	// The frame the sequence started in shows up as the delta of the one after it
+	if (!bSequenceHitchPending || GFrameCounter == SequenceStartFrame)
+	{
+		return;
+	}
+	bSequenceHitchPending = false;
+
+	const double FrameMs = FApp::GetDeltaTime() * 1000.0;
+	const double BudgetMs = CVarDiceSequenceHitchBudget.GetValueOnGameThread();
+	const bool bWarmedUp = CVarDiceSequenceWarmUp.GetValueOnGameThread();
+	const TCHAR* WarmUpText = bWarmedUp ? TEXT("warm-up on") : TEXT("warm-up off");
+
+	// Kept until the next sequence - compare a cold start with -dpcvars=dice.Sequence.WarmUp=0 against the default
+	SET_FLOAT_STAT(STAT_DiceSequenceStartCallMs, SequenceStartMs);
+	SET_FLOAT_STAT(STAT_DiceSequenceStartFrameMs, FrameMs);
+
+	if (FrameMs > BudgetMs)
+	{
+		INC_DWORD_STAT(STAT_DiceSequenceHitches);
+		UE_LOG(LogDiceGame, Warning, TEXT("%s sequence start frame took %.2f ms (start call %.2f ms, %s) - over the %.2f ms budget"),
+			SequenceHitchLabel, FrameMs, SequenceStartMs, WarmUpText, BudgetMs);
 	}
+	else
+	{
+		UE_LOG(LogDiceGame, Log, TEXT("%s sequence start frame took %.2f ms (start call %.2f ms, %s) - within the %.2f ms budget"),
+			SequenceHitchLabel, FrameMs, SequenceStartMs, WarmUpText, BudgetMs);
+	}
+
+	// Warm-up exists so the start call itself never costs a frame - if it still does, something is created
+	// or loaded on first use again. The whole frame can run long for unrelated reasons, so that only warns.
+	ensureMsgf(!bWarmedUp || SequenceStartMs <= BudgetMs,
+		TEXT("%s sequence start call took %.2f ms with warm-up on (budget %.2f ms) - something is still created on first use"),
+		SequenceHitchLabel, SequenceStartMs, BudgetMs);
 }
@@ -2,9 +2,13 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "GGJ26.h"
 #include "Dice.h"
 #include "DiceModifier.h"
 #include "IRButtonComponent.h"
+#include "DiceTimerWheel.h"
+#include "DiceBallistics.h"
+#include "DiceTimeline.h"
 #include "DiceGameManager.generated.h"
 
 class AMaskEnemy;
@@ -16,6 +20,7 @@ class UHangingBoardComponent;
 class UUserWidget;
 class UImage;
 class UIRButtonComponent;
+class UDiceEventBus;
 
 UENUM(BlueprintType)
 enum class EGamePhase : uint8
@@ -33,6 +38,51 @@ enum class EGamePhase : uint8
 	GameOver
 };
 
+// Completion-driven transitions - each gate opens once its signal has fired and its minimum dwell has passed
+enum class EPhaseGate : uint8
+{
+	CameraPan,          // Camera has (effectively) reached its pan target
+	EnemyDiceSettled,
+	PlayerDiceSettled,
+	RerollAllStart,     // Legacy pacing only - fixed wait before the RE:ALL lift
+	Count
+};
+
+// What a single player die is currently animating
+enum class EDiceAnim : uint8
+{
+	None,
+	Return,   // Bouncing back to where it was picked up
+	Snap,     // Flying onto a modifier
+	Flip,     // FLIP modifier spin
+	Match     // Flying onto the matching enemy dice
+};
+
+// Input that arrived while it couldn't be applied yet
+enum class EQueuedInput : uint8
+{
+	PickUp,   // Mouse pressed on a die that was still busy
+	GiveUp
+};
+
+// Second tick for the manager in TG_PostUpdateWork - moves the dragged die from a cursor sample taken right before rendering
+USTRUCT()
+struct FDiceLateUpdateTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	class ADiceGameManager* Manager = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FDiceLateUpdateTickFunction> : public TStructOpsTypeTraitsBase2<FDiceLateUpdateTickFunction>
+{
+	enum { WithCopy = false };
+};
+
 UCLASS()
 class ADiceGameManager : public AActor
 {
@@ -43,6 +93,10 @@ public:
 
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaTime) override;
+	virtual void RegisterActorTickFunctions(bool bRegister) override;
+
+	// Called from the late tick (TG_PostUpdateWork)
+	void LateTick(float DeltaTime);
 
 	// ===== SETUP =====
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Setup")
@@ -129,6 +183,16 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera")
 	float CameraPanSpeed;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (ToolTip = "Distance from the pan target at which the camera counts as arrived (transitions waiting on it can go)"))
+	float CameraArriveTolerance;
+
+	// ===== PACING =====
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pacing", meta = (ToolTip = "Minimum time dice spend in a settling phase before lining up"))
+	float SettleMinDwell;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pacing", meta = (ToolTip = "How long every die must stay still to count as settled (skipped once physics puts them all to sleep)"))
+	float SettleConfirmTime;
+
 	// ===== DICE LABEL (Fold prompt) =====
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dice Label", meta = (ToolTip = "TextRender actor for fold prompt - typewriter style"))
 	AActor* DiceLabelActor;
@@ -143,6 +207,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dragging")
 	float DragHeight;
 
+	// Exponential follow rate (1/s) - same feel at any frame rate. 0 = stick to the cursor
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dragging")
 	float DragFollowSpeed;
 
@@ -215,6 +280,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bonus Round")
 	bool bDebugBonusCamera;  // Lock camera to bonus view for testing
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bonus Round", meta = (ToolTip = "Longest the masked dice are left tumbling before the lineup takes over. Their faces are decided up front, so the lineup does not need them at rest."))
+	float BonusSettleTimeout;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bonus Round", meta = (ToolTip = "TextRender actor for Masquerade UI - shows with glitchy typewriter effect"))
 	AActor* MasqueradeUIActor;
 
@@ -277,15 +345,19 @@ private:
 	void OnStartGamePressed();
 	void OnPlayerThrowPressed();
 	void OnPlayerActionPressed();  // E key - unified action
+#if DICE_DEBUG_DRAW
 	void OnToggleDebugPressed();
 	void OnToggleFaceRotationMode();
+#endif
 	void OnSelectNext();
 	void OnSelectPrev();
 	void OnConfirmSelection();
 	void OnCancelSelection();
 	void OnGiveUpPressed();
+#if DICE_DEBUG_DRAW
 	void OnDebugKillEnemy();  // X key - damage enemy for testing
 	void OnDebugKillPlayer(); // Z key - damage player for testing
+#endif
 	void UpdateDiceDebugVisibility();
 
 	void EnemyThrowDice();
@@ -308,7 +380,7 @@ private:
 	void StartDiceLiftForReroll();
 	void UpdateDiceLiftForReroll(float DeltaTime);
 	void UpdateDiceFaceDisplay(ADice* Dice, int32 NewValue);
-	void SnapDiceToModifier(int32 DiceIndex, ADiceModifier* Modifier);
+	void SnapDiceToModifier(int32 DiceIndex, ADiceModifier* Modifier, bool bRerollAfter = false);
 	void CheckAllMatched();
 	void DealDamage(bool bToEnemy);
 	void CheckGameOver();
@@ -320,8 +392,10 @@ private:
 	void ClearAllDice();
 	void StartDiceDisperse();
 	void UpdateDiceDisperse(float DeltaTime);
+#if DICE_DEBUG_DRAW
 	void DrawTurnText();
 	void DrawHealthBars();
+#endif
 
 	FRotator GetRotationForFaceUp(int32 FaceValue);
 	FVector GetLineupWorldCenter();
@@ -335,7 +409,7 @@ private:
 	bool bPlayerDiceSettled;
 	float LineupProgress;
 	float PlayerLineupProgress;
-	float WaitTimer;
+	double DiceStillSinceTime;  // When every die last became still
 	float StaggerDelay;
 
 	TArray<FVector> EnemyDiceStartPositions;
@@ -357,6 +431,9 @@ private:
 	int32 HoveredModifierIndex;
 	ADice* LastHoveredDice;
 
+	// Native event bus (cached - settle/hover/match publish every frame they happen)
+	UDiceEventBus* EventBus;
+
 	// Dragging state
 	bool bIsDragging;
 	ADice* DraggedDice;
@@ -364,36 +441,56 @@ private:
 	FVector OriginalDragPosition;
 	FRotator OriginalDragRotation;
 	FVector LastDragPosition;
-
-	// Return animation
-	bool bDiceReturning;
-	ADice* ReturningDice;
-	int32 ReturningDiceIndex;
-	float ReturnProgress;
-	FVector ReturnStartPos;
-	FRotator ReturnStartRot;
-	FVector ReturnTargetPos;
-	FRotator ReturnTargetRot;
-	FVector ReturnVelocity;
-
-	// Modifier snap animation
-	bool bDiceSnappingToModifier;
-	ADiceModifier* SnapTargetModifier;
-	int32 SnapDiceIndex;
-
-	// Modifier effect animation
-	bool bDiceFlipping;
-	int32 FlipDiceIndex;
-	float FlipProgress;
-	FRotator FlipStartRot;
-	FRotator FlipTargetRot;
+	double DragStartInputTime;  // Frame the press was pumped in (FPlatformTime seconds)
+	bool bDragFirstMotion;      // Next drag move is the first one after the press
+
+	FDiceLateUpdateTickFunction LateUpdateTick;
+
+	// Per-die animations - every player die animates on its own so several can overlap
+	struct FPlayerDiceAnim
+	{
+		EDiceAnim Type = EDiceAnim::None;
+		float Progress = 0.0f;
+		FVector StartPos = FVector::ZeroVector;
+		FRotator StartRot = FRotator::ZeroRotator;
+		FVector TargetPos = FVector::ZeroVector;
+		FRotator TargetRot = FRotator::ZeroRotator;
+		ADiceModifier* Modifier = nullptr;  // Snap target
+		int32 EnemyIndex = INDEX_NONE;      // Match target
+		bool bRerollAfter = false;          // RE:1 - throw once snapped
+	};
+	TArray<FPlayerDiceAnim> PlayerDiceAnims;   // Parallel to PlayerDice
+	TArray<TFunction<void()>> AfterDiceAnims;  // Whole-hand actions (rerolls) waiting for every die to be free
+
+	FPlayerDiceAnim& StartDiceAnim(int32 DiceIndex, EDiceAnim Type);
+	bool IsDiceAnimating(int32 DiceIndex) const;
+	bool IsAnyDiceAnimating() const;
+	bool IsEnemyDiceClaimed(int32 EnemyIndex) const;
+	void RunWhenDiceAnimsIdle(TFunction<void()>&& Action);
+	void UpdatePlayerDiceAnims(float DeltaTime);
+	void ResetDiceAnims();
+
+	// Input queue
+	struct FQueuedInput
+	{
+		EQueuedInput Type;
+		ADice* Dice;
+	};
+	TArray<FQueuedInput> QueuedInputs;
+	bool IsMatchInputBlocked(int32 DiceIndex) const;  // INDEX_NONE checks only whole-hand blocks
+	bool IsGiveUpBlocked() const;
+	void QueueInput(EQueuedInput Type, ADice* Dice);
+	void ProcessQueuedInputs();
+
+	// Matching throughput (actions per second while matching)
+	float MatchingActiveTime;
+	int32 MatchingActionCount;
+	int32 MatchingQueuedCount;
+	void ReportMatchingThroughput();
 
 	// Reroll from modifier
-	bool bRerollAfterSnap;
-	int32 RerollDiceIndex;
-	bool bRerollAll;
-	bool bWaitingForCameraToRerollAll;
-	float RerollAllWaitTimer;
+	bool bWaitingForCameraToRerollAll;  // RE:ALL used, dice not thrown yet
+	bool bRerollThrowQueued;            // Lift finished, throw waiting on the camera
 	bool bDiceLiftingForReroll;
 	float DiceLiftProgress;
 	TArray<FVector> RerollStartPositions;
@@ -404,75 +501,113 @@ private:
 	void UpdateMouseInput();
 	AActor* GetActorUnderMouse(FVector& HitLocation);
 	FVector GetMouseWorldPosition();
+	bool GetLateMouseWorldPosition(FVector& OutWorld, double& OutSampleTime);
+	FVector ProjectToDragPlane(const FVector& WorldLocation, const FVector& WorldDirection) const;
 	void StartDragging(ADice* Dice, int32 Index);
 	void StopDragging(bool bSuccess);
 	void PhysicsBounceBack();
-	void UpdateDragging();
-	void UpdateDiceReturn(float DeltaTime);
-	void UpdateModifierSnap(float DeltaTime);
-	void UpdateDiceFlip(float DeltaTime);
+	void UpdateDragging(float DeltaTime, bool bLateSample);
+	void TraceDragLatency(double InputTime, double SampleTime);
+	void UpdateDiceReturn(int32 DiceIndex, float DeltaTime);
+	void UpdateModifierSnap(int32 DiceIndex, float DeltaTime);
+	void UpdateDiceFlip(int32 DiceIndex, float DeltaTime);
 	void StartDiceFlip(int32 DiceIndex, int32 NewValue);
-	void UpdateMatchAnimation(float DeltaTime);
+	void UpdateMatchAnimation(int32 DiceIndex, float DeltaTime);
 	void StartMatchAnimation(int32 PlayerIdx, int32 EnemyIdx);
 	void HighlightValidTargets();
 	void ClearAllHighlights();
 	void PlayMatchEffect(FVector Location);
 
-	// Match animation (Balatro style)
-	bool bMatchAnimating;
-	int32 MatchPlayerIndex;
-	int32 MatchEnemyIndex;
-	float MatchAnimProgress;
-	FVector MatchStartPos;
-	FVector MatchTargetPos;
-
 	void ActivateModifiers();
 	void DeactivateModifiers();
 	void ResetModifiersForNewRound();
+	void GetShuffleableModifiers(TArray<ADiceModifier*>& OutModifiers) const;
 	void StartModifierShuffle();
 	void UpdateModifierShuffle(float DeltaTime);
 
 	// Hand chop integration
 	void TriggerPlayerChop();
 	void TriggerEnemyChop();
-	UFUNCTION()
 	void OnPlayerChopComplete();
-	UFUNCTION()
 	void OnEnemyChopComplete();
 	UPlayerHandComponent* GetPlayerHand();
 	UPlayerHandComponent* GetEnemyHand();
+
+	// Timer wheel helpers (callbacks are dropped if the manager is destroyed)
+	FDiceTimerHandle ScheduleTimer(float Delay, TFunction<void()>&& Callback, float RepeatInterval = 0.0f);
+	void CancelTimer(FDiceTimerHandle& Handle);
+
 	bool bWaitingForChop;
-	bool bWaitingForCameraThenEnemyChop;  // Wait for camera pan to finish before enemy chop
+
+	// Phase gates
+	struct FPhaseGate
+	{
+		TFunction<void()> Continuation;
+		double ArmedTime = 0.0;
+		double SignalTime = 0.0;
+		double SignalRealTime = 0.0;   // Wall clock - pacing is reported in real seconds
+		float MinDwell = 0.0f;         // Measured from arming
+		float HoldAfterSignal = 0.0f;  // Measured from the signal (legacy fixed waits)
+		bool bArmed = false;
+		bool bSignalled = false;
+		FDiceTimerHandle DwellHandle;
+	};
+	FPhaseGate PhaseGates[(int32)EPhaseGate::Count];
+	bool bCameraArrived;
+
+	void ArmPhaseGate(EPhaseGate Gate, float MinDwell, TFunction<void()>&& Continuation);
+	void SignalPhaseGate(EPhaseGate Gate, float HoldAfterSignal = 0.0f);
+	void UnsignalPhaseGate(EPhaseGate Gate);  // Condition no longer holds (e.g. a die got knocked)
+	void CancelPhaseGate(EPhaseGate Gate);
+	void TryOpenPhaseGate(EPhaseGate Gate);
+	void RunAfterCameraPan(TFunction<void()>&& Continuation);
+	void ArmEnemySettleGate();
+	void ArmPlayerSettleGate();
+	bool IsLegacyPacing() const;
+
+	// Per-round pacing instrumentation
+	int32 PacingRound;
+	double PacingRoundStartTime;  // FPlatformTime::Seconds - wall clock, not dilated or paused game time
+	float PacingDeadWait;      // Time between a transition's completion signal and the transition itself
+	int32 PacingTransitions;
+	void ReportRoundPacing();
+
+	// Scripted arcs (disperse, masked dice fly-away, bonus result bounce) - stepped once per tick
+	FDiceBallistics Ballistics;
 
 	// Dice disperse animation
 	bool bDiceDispersing;
 	float DiceDisperseProgress;
 	TArray<ADice*> DispersingDice;
-	TArray<FVector> DisperseStartPositions;
-	TArray<FVector> DisperseVelocities;
-	TArray<float> DisperseStartScales;
+	TArray<FDiceBallisticHandle> DisperseBodies;
 
 	void StartCameraPan();
 	void UpdateCameraPan(float DeltaTime);
 	void ResetCamera();
 
 	// Adjust mode
+#if DICE_DEBUG_DRAW
 	void UpdateAdjustMode();
 	void DrawAdjustGizmos();
 	void PrintCurrentSettings();
+#endif
 	int32 AdjustSelection; // 0=Center, 1=EnemyRow, 2=PlayerRow, 3=Spacing, 4=Yaw
 
 	// Face rotation tool
 	bool bFaceRotationMode;
 	int32 CurrentFaceEdit; // 1-6
 	TArray<FRotator> FaceRotations;
+#if DICE_DEBUG_DRAW
 	void UpdateFaceRotationMode();
 	void SpawnTestDice();
 	void UpdateTestDice();
+#endif
 	ADice* TestDice;
 
 	FVector OriginalCameraLocation;
 	FRotator OriginalCameraRotation;
+	FVector CameraPanLocation;     // Pan layer pose, eased toward the target each frame
+	FRotator CameraPanRotation;
 	float CameraPanProgress;
 	bool bCameraPanning;
 	bool bCameraAtMatchView;
@@ -487,9 +622,35 @@ private:
 	float FadingModifierAlpha;
 	int32 CurrentRound;
 
+	// Next round pipeline - staged while the chop plays so the throw starts on the chop-complete frame
+	struct FStagedDiceThrow
+	{
+		FVector SpawnLocation;
+		FRotator SpawnRotation;
+		FVector ThrowDirection;
+	};
+	struct FModifierShufflePlan
+	{
+		int32 Round = 0;
+		TArray<ADiceModifier*> Available;  // Plan is only used if this still matches
+		int32 RemoveIndex = INDEX_NONE;    // Index into Available to permanently remove
+		TArray<int32> TargetOrder;         // Remaining modifier i moves to the position of remaining modifier TargetOrder[i]
+	};
+	UPROPERTY()
+	TArray<ADice*> StagedEnemyDice;   // Spawned, configured, hidden at their spawn points
+	TArray<FStagedDiceThrow> StagedEnemyThrows;
+	FModifierShufflePlan ModifierShufflePlan;
+	bool bStagingNextRound;
+
+	void StageNextRound();
+	void UpdateNextRoundStaging();
+	void StageNextEnemyDice();
+	void DiscardStagedRound();
+	void DrawEnemyThrows(TArray<FStagedDiceThrow>& OutThrows);
+	void BuildModifierShufflePlan(const TArray<ADiceModifier*>& Available, int32 ForRound, FModifierShufflePlan& OutPlan);
+
 	// Round timer integration
 	URoundTimerComponent* GetRoundTimer();
-	UFUNCTION()
 	void OnRoundTimerExpired();
 	URoundTimerComponent* CachedRoundTimer;
 
@@ -498,11 +659,8 @@ private:
 	UIRButtonComponent* GetYesButton();
 	UIRButtonComponent* GetNoButton();
 	void StartBonusRoundPrompt();
-	UFUNCTION()
 	void OnBoardArrived();
-	UFUNCTION()
 	void OnBonusButtonPressed(EIRButtonType ButtonType);
-	UFUNCTION()
 	void OnBoardRetracted();
 
 	UHangingBoardComponent* CachedHangingBoard;
@@ -521,6 +679,7 @@ private:
 	ADice* BonusPlayerDice;            // Player's YES dice to drag
 	ADice* BonusRevealDice;            // Shows the total after player chooses
 
+	int32 BonusEnemyFaces[2];          // Faces the masked dice end up showing
 	int32 BonusEnemyTotal;             // Sum of enemy dice (not 7)
 	bool bBonusIsHigher;               // True if total > 7
 	bool bPlayerGuessedHigher;         // What player chose
@@ -531,39 +690,28 @@ private:
 	static const int32 BaseDiceCount = 5;  // Default dice count to return to
 
 	float BonusAnimTimer;
+	FDiceTimerHandle BonusWaitHandle;  // Timed bonus phase steps (1, 4, 9)
 	float BonusLineupProgress;
 	float BonusPlayerLineupProgress;
 	float BonusRevealProgress;
 
 	// Masquerade UI Typewriter
 	class UTextRenderComponent* MasqueradeUIText;
-	FString MasqueradeFullText;
-	FString MasqueradeCurrentText;
-	float TypewriterTimer;
-	int32 TypewriterIndex;
-	bool bTypewriterActive;
-	bool bTypewriterOut;  // True = typing out (reverse), False = typing in
-	float GlitchTimer;
-	bool bShowingGlitch;
-	FString GlitchChars;
+	class UDiceTextRevealComponent* MasqueradeReveal;
+	FString MasqueradeFullText;  // Authored label text, captured before the first reveal blanks it
 
 	void StartMasqueradeTypewriter();
 	void StartMasqueradeTypewriterOut();  // Reverse effect
-	void UpdateMasqueradeTypewriter(float DeltaTime);
+	void HandleMasqueradeRevealFinished(bool bTypedOut);
 	void HideMasqueradeUI();
 
 	// Dice Label Typewriter (fold prompt)
 	class UTextRenderComponent* DiceLabelTextComp;
-	FString DiceLabelFullText;
-	FString DiceLabelCurrentText;
-	float DiceLabelTypeTimer;
-	int32 DiceLabelTypeIndex;
-	bool bDiceLabelTypewriterActive;
-	bool bDiceLabelTypewriterOut;
+	class UDiceTextRevealComponent* DiceLabelReveal;
 
 	void StartDiceLabelTypewriter();
 	void StartDiceLabelTypewriterOut();
-	void UpdateDiceLabelTypewriter(float DeltaTime);
+	void HandleDiceLabelRevealFinished(bool bTypedOut);
 	void HideDiceLabel();
 
 	TArray<FVector> BonusDiceStartPositions;
@@ -593,7 +741,7 @@ private:
 	void EndBonusRound(bool bWon);
 	void UpdateBonusRound(float DeltaTime);
 	void CleanupBonusRound();
-	int32 GenerateBonusTotal();
+	void GenerateBonusDice();
 
 	// Bonus reveal animation states
 	// RevealPhase: 0=shake, 1=strike incoming, 2=impact/fly away, 3=result slide, 4=done
@@ -603,7 +751,7 @@ private:
 	FVector RevealDiceStartPos;
 	FVector RevealDiceTargetPos;
 	TArray<FVector> MaskedDicePreShakePos;
-	TArray<FVector> MaskedDiceFlyVelocity;
+	TArray<FDiceBallisticHandle> MaskedDiceFlyBodies;
 
 	// Bonus dice snap animation (for player dice placement)
 	bool bBonusDiceSnapping;
@@ -621,11 +769,9 @@ private:
 	FVector BonusRevealDiceStartPos;
 	FRotator BonusRevealDiceStartRot;
 	FVector BonusResultTargetPos;  // Where both dice bounce to
-	FVector BonusPlayerVelocity;   // Physics velocity for player dice
-	FVector BonusRevealVelocity;   // Physics velocity for reveal dice
-	float BonusPlayerRotSpeed;     // Rotation speed
-	float BonusRevealRotSpeed;
-	int32 BonusBounceCount;        // Track bounces for damping
+	FDiceBallisticHandle BonusPlayerBody;  // Arc + bounce for player dice
+	FDiceBallisticHandle BonusRevealBody;  // Arc + bounce for reveal dice
+	int32 BonusBounceCount;        // Player dice bounces already reacted to
 	float BonusResultFloorZ;       // Floor level for bouncing
 
 	// Bonus camera shake
@@ -643,30 +789,34 @@ private:
 	void UpdateBonusCameraFocus(float DeltaTime);
 	FVector BonusCameraTargetPos;
 	FRotator BonusCameraTargetRot;
-	FVector BonusCameraOriginalPos;
-	FRotator BonusCameraOriginalRot;
 	float BonusCameraProgress;
 	bool bBonusCameraFocusing;
 	bool bBonusCameraReturning;
 
 	// ===== WIN SEQUENCE =====
 	// Phases: 0=inactive, 1=modifiers fade, 2=mask float toward camera + fade, 3=done
+	// Timed by a timeline: float tracks "ModifierFade" (read per modifier, staggered), "MaskTravel" (0..1 start -> target pose),
+	// "MaskScale", "MaskFloat", "MaskWobble" and "Fade"; event "HideModifiers" starts phase 2 and the end of the timeline finishes.
+	// A "Mask" transform track, if present, replaces the start -> target travel with keyed relative transforms.
+	UPROPERTY(EditAnywhere, Category = "Win Sequence", meta = (ToolTip = "Timeline for the win sequence - built-in timing is used when unset"))
+	UDiceTimelineAsset* WinTimeline;
+
+	UPROPERTY(Transient)
+	UDiceTimelineAsset* DefaultWinTimeline;
+
+	FDiceTimelinePlayer WinTimelinePlayer;
 	int32 WinSequencePhase;
-	float WinSequenceTimer;
-	float WinSequenceProgress;
+	float WinMaskFloatStartTime;  // Timeline time phase 2 began - the float/wobble sines start from here
 
 	// Mask mesh animation (move mesh component, not actor)
 	FVector WinMaskMeshStartPos;      // Mesh component's starting relative position
 	FRotator WinMaskMeshStartRot;     // Mesh component's starting relative rotation
 	FVector WinMaskMeshTargetPos;     // Target RELATIVE position (close to player)
 	FRotator WinMaskMeshTargetRot;    // Target RELATIVE rotation
-	float WinMaskRotationProgress;    // For rotation tracking
 
 	// Win camera breathing (faster, more intense)
 	bool bWinCameraBreathing;
 	float WinCameraBreathTimer;
-	FVector WinCameraBasePos;
-	FRotator WinCameraBaseRot;
 
 	// Fade to black - UMG Widget
 	UPROPERTY(EditAnywhere, Category = "Win Sequence", meta = (ToolTip = "UMG Widget with a UImage named BlackImage for fade effect"))
@@ -678,21 +828,28 @@ private:
 	UPROPERTY()
 	UImage* BlackImageWidget;
 
-	float WinFadeAlpha;
-
-	// Modifier fade
-	TArray<float> ModifierFadeAlpha;
-
 	void StartWinSequence();
 	void UpdateWinSequence(float DeltaTime);
-	void UpdateModifierFade(float DeltaTime);
-	void UpdateMaskFloat(float DeltaTime);
-	void UpdateScreenFade(float DeltaTime);
+	void HandleWinTimelineEvent(FName Event);
+	void UpdateModifierFade();
+	void UpdateMaskFloat();
 	void OnWinSequenceComplete();
 	void CreateFadeWidget();
+	void SetScreenFade(float Alpha);
+	UDiceTimelineAsset* GetWinTimeline();
 
 	// ===== LOSE SEQUENCE =====
-	// Phases: 0=inactive, 1=breathing+pan down, 2=mask drop+knife drop, 3=fade out, 4=done
+	// Phases: 0=inactive, 1=breathing+pan down, 2=mask drop+knife drop+fade out, 3=done
+	// Timed by a timeline: float tracks "CameraPan" (0..1 start -> looking down) and "Fade"; event "DropMask" starts phase 2
+	// and the end of the timeline finishes. A "CameraOffset" transform track, if present, is added on top of the pan.
+	UPROPERTY(EditAnywhere, Category = "Lose Sequence", meta = (ToolTip = "Timeline for the lose sequence - built-in timing is used when unset"))
+	UDiceTimelineAsset* LoseTimeline;
+
+	UPROPERTY(Transient)
+	UDiceTimelineAsset* DefaultLoseTimeline;
+
+	FDiceTimelinePlayer LoseTimelinePlayer;
+
 	UPROPERTY(EditAnywhere, Category = "Lose Sequence", meta = (ToolTip = "Static mesh for player's mask that drops on lose"))
 	UStaticMesh* PlayerMaskMesh;
 
@@ -709,9 +866,6 @@ private:
 	float LoseCameraForwardOffset;
 
 	int32 LoseSequencePhase;
-	float LoseSequenceTimer;
-	float LoseSequenceProgress;
-	float LoseFadeAlpha;
 
 	// Camera pan down
 	FVector LoseCameraStartPos;
@@ -720,16 +874,39 @@ private:
 	bool bLoseCameraBreathing;
 	float LoseCameraBreathTimer;
 
-	// Player mask drop (not UPROPERTY - owned by spawned actor)
+	// Player mask drop - actor is spawned hidden during warm-up, DroppedPlayerMask is its root
+	UPROPERTY(Transient)
+	AActor* PlayerMaskActor;
+
 	UStaticMeshComponent* DroppedPlayerMask;
 	FVector PlayerMaskDropStartPos;
 
 	// Knife drop (not UPROPERTY - just a reference)
 	UStaticMeshComponent* DroppedKnife;
 
+	// Found during warm-up so the drop doesn't search the hand
+	UPROPERTY(Transient)
+	UStaticMeshComponent* SequenceKnife;
+
 	void StartLoseSequence();
 	void UpdateLoseSequence(float DeltaTime);
+	void HandleLoseTimelineEvent(FName Event);
+	UDiceTimelineAsset* GetLoseTimeline();
 	void SpawnAndDropPlayerMask();
 	void DropLastKnife();
 	void OnLoseSequenceComplete();
+
+	// ===== SEQUENCE WARM-UP =====
+	// Everything the win/lose sequences touch is created at BeginPlay, so starting one only flips visibility
+	void WarmUpSequences();
+	void SpawnPlayerMaskActor();
+	UStaticMeshComponent* FindSequenceKnife();
+
+	// Hitch capture - the frame a sequence starts in is checked against dice.Sequence.HitchBudgetMs
+	void ArmSequenceHitchCapture(const TCHAR* Label, uint64 StartCycles);
+	void ReportSequenceHitch();
+	const TCHAR* SequenceHitchLabel;
+	double SequenceStartMs;
+	uint64 SequenceStartFrame;
+	bool bSequenceHitchPending;
 };
@@ -0,0 +1,630 @@
+#include "DiceLabelBatcher.h"
+#include "GGJ26.h"
+#include "Components/TextRenderComponent.h"
+#include "Engine/Font.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarDiceLabelBatching(
+	TEXT("dice.Labels.Batch"),
+	true,
+	TEXT("Draw in-world labels through the batched label mesh. Applies to labels created after the change (restart the level to compare)."),
+	ECVF_Default);
+
+DECLARE_CYCLE_STAT(TEXT("Label Batch Update"), STAT_DiceLabelBatchUpdate, STATGROUP_DiceGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Label Glyph Rewrites"), STAT_DiceLabelGlyphRewrites, STATGROUP_DiceGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Label Batch Uploads"), STAT_DiceLabelBatchUploads, STATGROUP_DiceGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Label Batches"), STAT_DiceLabelBatches, STATGROUP_DiceGame);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Batched Labels"), STAT_DiceBatchedLabels, STATGROUP_DiceGame);
+
+UDiceLabelBatcher::UDiceLabelBatcher()
+{
+	MeshComponent = nullptr;
+}
+
+void UDiceLabelBatcher::Deinitialize()
+{
+	Labels.Empty();
+	LabelLookup.Empty();
+	Batches.Empty();
+	BatchMaterials.Empty();
+	MeshComponent = nullptr;
+
+	Super::Deinitialize();
+}
+
+TStatId UDiceLabelBatcher::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDiceLabelBatcher, STATGROUP_Tickables);
+}
+
+UDiceLabelBatcher* UDiceLabelBatcher::Get(const UObject* WorldContext)
+{
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDiceLabelBatcher>() : nullptr;
+}
+
+UDiceLabelBatcher::FBatchedLabel* UDiceLabelBatcher::FindLabel(const UTextRenderComponent* Label)
+{
+	const int32* Index = LabelLookup.Find(Label);
+	return Index ? &Labels[*Index] : nullptr;
+}
+
+bool UDiceLabelBatcher::WasLabelRecentlyRendered(const UTextRenderComponent* Label, float Tolerance) const
+{
+	const int32* Index = LabelLookup.Find(Label);
+	if (!Index || !Labels[*Index].bVisible)
+	{
+		return false;
+	}
+	return MeshComponent && MeshComponent->WasRecentlyRendered(Tolerance);
+}
+
+// ==================== LABEL API ====================
+
+bool UDiceLabelBatcher::Adopt(UTextRenderComponent* Label)
+{
+	UDiceLabelBatcher* Batcher = Get(Label);
+	return Batcher && Batcher->AdoptLabel(Label);
+}
+
+void UDiceLabelBatcher::SetText(UTextRenderComponent* Label, const FText& Text)
+{
+	if (!Label) return;
+
+	UDiceLabelBatcher* Batcher = Get(Label);
+	FBatchedLabel* Batched = Batcher ? Batcher->FindLabel(Label) : nullptr;
+	if (!Batched)
+	{
+		Label->SetText(Text);
+		return;
+	}
+
+	// Keep the component's copy readable without dirtying its render state
+	Label->Text = Text;
+
+	const FString& NewText = Text.ToString();
+	if (!NewText.Equals(Batched->Text, ESearchCase::CaseSensitive))
+	{
+		Batched->Text = NewText;
+		Batched->bLayoutDirty = true;
+	}
+}
+
+void UDiceLabelBatcher::SetText(UTextRenderComponent* Label, FStringView Text)
+{
+	if (!Label) return;
+
+	UDiceLabelBatcher* Batcher = Get(Label);
+	FBatchedLabel* Batched = Batcher ? Batcher->FindLabel(Label) : nullptr;
+	if (!Batched)
+	{
+		Label->SetText(FText::FromString(FString(Text)));
+		return;
+	}
+
+	if (!Text.Equals(Batched->Text, ESearchCase::CaseSensitive))
+	{
+		// Reset keeps the allocation - a label animating within its length never reallocates
+		Batched->Text.Reset();
+		Batched->Text.Append(Text.GetData(), Text.Len());
+		Batched->bLayoutDirty = true;
+	}
+}
+
+void UDiceLabelBatcher::SetColor(UTextRenderComponent* Label, FColor Color)
+{
+	if (!Label) return;
+
+	UDiceLabelBatcher* Batcher = Get(Label);
+	FBatchedLabel* Batched = Batcher ? Batcher->FindLabel(Label) : nullptr;
+	if (!Batched)
+	{
+		Label->SetTextRenderColor(Color);
+		return;
+	}
+
+	Label->TextRenderColor = Color;
+	if (Batched->Color != Color)
+	{
+		Batched->Color = Color;
+		Batched->bColorDirty = true;
+	}
+}
+
+void UDiceLabelBatcher::SetWorldSize(UTextRenderComponent* Label, float WorldSize)
+{
+	if (!Label) return;
+
+	UDiceLabelBatcher* Batcher = Get(Label);
+	FBatchedLabel* Batched = Batcher ? Batcher->FindLabel(Label) : nullptr;
+	if (!Batched)
+	{
+		Label->SetWorldSize(WorldSize);
+		return;
+	}
+
+	Label->WorldSize = WorldSize;
+	if (Batched->WorldSize != WorldSize)
+	{
+		Batched->WorldSize = WorldSize;
+		Batched->bLayoutDirty = true;
+	}
+}
+
+// ==================== ADOPTION ====================
+
+bool UDiceLabelBatcher::AdoptLabel(UTextRenderComponent* Label)
+{
+	if (!Label || !CVarDiceLabelBatching.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	if (LabelLookup.Contains(Label))
+	{
+		return true;
+	}
+
+	// Only offline (texture atlas) fonts on a single page can share one section
+	UFont* Font = Label->Font;
+	if (!Font || Font->FontCacheType != EFontCacheType::Offline || Font->Textures.Num() != 1 || !Font->Textures[0])
+	{
+		UE_LOG(LogDiceGame, Verbose, TEXT("Label %s keeps its own text render (font can't be batched)"), *Label->GetPathName());
+		return false;
+	}
+
+	UMaterialInterface* Material = Label->TextMaterial;
+	if (!Material || !EnsureMeshComponent())
+	{
+		return false;
+	}
+
+	FBatchedLabel NewLabel;
+	NewLabel.Source = Label;
+	NewLabel.Text = Label->Text.ToString();
+	NewLabel.Color = Label->TextRenderColor;
+	NewLabel.WorldSize = Label->WorldSize;
+	NewLabel.Batch = FindOrAddBatch(Font, Material);
+
+	const int32 Index = Labels.Add(MoveTemp(NewLabel));
+	LabelLookup.Add(Label, Index);
+
+	// The component stays as the label's data - the batch draws it from now on
+	Label->SetHiddenInGame(true);
+
+	return true;
+}
+
+bool UDiceLabelBatcher::EnsureMeshComponent()
+{
+	if (MeshComponent)
+	{
+		return true;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	FActorSpawnParameters Params;
+	Params.ObjectFlags |= RF_Transient;
+	AActor* Host = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+	if (!Host)
+	{
+		return false;
+	}
+
+	// Vertices are written in world space
+	MeshComponent = NewObject<UProceduralMeshComponent>(Host, TEXT("LabelBatchMesh"));
+	MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	MeshComponent->SetCastShadow(false);
+	MeshComponent->bUseAsyncCooking = false;
+	Host->SetRootComponent(MeshComponent);
+	MeshComponent->RegisterComponent();
+
+	return true;
+}
+
+int32 UDiceLabelBatcher::FindOrAddBatch(UFont* Font, UMaterialInterface* Material)
+{
+	for (int32 i = 0; i < Batches.Num(); i++)
+	{
+		if (Batches[i].Font == Font && Batches[i].Material == Material)
+		{
+			return i;
+		}
+	}
+
+	FLabelBatch& Batch = Batches.AddDefaulted_GetRef();
+	Batch.Font = Font;
+	Batch.Material = Material;
+
+	// Bind the font atlas the same way a text render component does
+	Batch.MID = UMaterialInstanceDynamic::Create(Material, this);
+	TArray<FMaterialParameterInfo> FontParams;
+	TArray<FGuid> FontParamIds;
+	Material->GetAllFontParameterInfo(FontParams, FontParamIds);
+	for (const FMaterialParameterInfo& Param : FontParams)
+	{
+		Batch.MID->SetFontParameterValue(Param, Font, 0);
+	}
+	BatchMaterials.Add(Batch.MID);
+
+	SET_DWORD_STAT(STAT_DiceLabelBatches, Batches.Num());
+	return Batches.Num() - 1;
+}
+
+// ==================== GLYPH SLOTS ====================
+
+void UDiceLabelBatcher::AllocateSlots(FBatchedLabel& Label, int32 NumGlyphs)
+{
+	FLabelBatch& Batch = Batches[Label.Batch];
+	const int32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(NumGlyphs, 4));
+
+	ReleaseSlots(Label);
+
+	// Reuse a returned range if one fits
+	for (int32 i = 0; i < Batch.FreeRanges.Num(); i++)
+	{
+		if (Batch.FreeRanges[i].Y >= Capacity)
+		{
+			Label.FirstGlyph = Batch.FreeRanges[i].X;
+			Label.Capacity = Batch.FreeRanges[i].Y;
+			Batch.FreeRanges.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			return;
+		}
+	}
+
+	Label.FirstGlyph = Batch.NumSlots;
+	Label.Capacity = Capacity;
+	Batch.NumSlots += Capacity;
+
+	const int32 NumVerts = Batch.NumSlots * 4;
+	Batch.Positions.SetNumZeroed(NumVerts);
+	Batch.Normals.SetNumZeroed(NumVerts);
+	Batch.Tangents.SetNum(NumVerts);
+	Batch.UV0.SetNumZeroed(NumVerts);
+	Batch.Colors.SetNumZeroed(NumVerts);
+	Batch.bNeedsRecreate = true;
+}
+
+void UDiceLabelBatcher::ReleaseSlots(FBatchedLabel& Label)
+{
+	if (Label.Capacity == 0)
+	{
+		return;
+	}
+
+	FLabelBatch& Batch = Batches[Label.Batch];
+	CollapseSlots(Batch, Label.FirstGlyph, Label.Capacity);
+	Batch.FreeRanges.Add(FIntPoint(Label.FirstGlyph, Label.Capacity));
+	Batch.bDirty = true;
+
+	Label.FirstGlyph = 0;
+	Label.Capacity = 0;
+}
+
+void UDiceLabelBatcher::CollapseSlots(FLabelBatch& Batch, int32 First, int32 Count)
+{
+	// Zero-area quads draw nothing
+	for (int32 v = First * 4; v < (First + Count) * 4; v++)
+	{
+		Batch.Positions[v] = FVector::ZeroVector;
+	}
+}
+
+// ==================== LAYOUT ====================
+
+void UDiceLabelBatcher::Layout(FBatchedLabel& Label)
+{
+	UTextRenderComponent* Source = Label.Source.Get();
+	UFont* Font = Batches[Label.Batch].Font;
+	UTexture* Atlas = Font->Textures[0];
+
+	Label.Glyphs.Reset();
+
+	const float MaxCharHeight = Font->GetMaxCharHeight();
+	if (MaxCharHeight <= 0.0f)
+	{
+		return;
+	}
+
+	// Same metrics as UTextRenderComponent
+	const float XScale = Source->XScale * Label.WorldSize / MaxCharHeight;
+	const float YScale = Source->YScale * Label.WorldSize / MaxCharHeight;
+	const float LineHeight = MaxCharHeight * YScale + Source->VertSpacingAdjust;
+	const float InvAtlasWidth = 1.0f / FMath::Max(Atlas->GetSurfaceWidth(), 1.0f);
+	const float InvAtlasHeight = 1.0f / FMath::Max(Atlas->GetSurfaceHeight(), 1.0f);
+
+	int32 NumLines = 1;
+	for (TCHAR Ch : Label.Text)
+	{
+		if (Ch == TEXT('\n'))
+		{
+			NumLines++;
+		}
+	}
+
+	// Top of the first line
+	float LineTop = 0.0f;
+	switch (Source->VerticalAlignment)
+	{
+		case EVRTA_TextCenter: LineTop = NumLines * LineHeight * 0.5f; break;
+		case EVRTA_TextBottom: LineTop = NumLines * LineHeight; break;
+		default:               break;
+	}
+
+	const FString& Text = Label.Text;
+	int32 LineStart = 0;
+	while (LineStart <= Text.Len())
+	{
+		int32 LineEnd = LineStart;
+		while (LineEnd < Text.Len() && Text[LineEnd] != TEXT('\n'))
+		{
+			LineEnd++;
+		}
+
+		const int32 FirstQuad = Label.Glyphs.Num();
+		float PenX = 0.0f;
+		TCHAR Previous = 0;
+		for (int32 i = LineStart; i < LineEnd; i++)
+		{
+			const TCHAR Ch = Text[i];
+			const int32 CharIndex = Font->RemapChar(Ch);
+			if (!Font->Characters.IsValidIndex(CharIndex))
+			{
+				continue;
+			}
+
+			const FFontCharacter& Glyph = Font->Characters[CharIndex];
+			if (Previous != 0)
+			{
+				PenX += Font->GetCharKerning(Previous, Ch) * XScale;
+			}
+
+			const float SizeX = Glyph.USize * XScale;
+			const float SizeY = Glyph.VSize * YScale;
+			if (SizeX > 0.0f && SizeY > 0.0f && !FChar::IsWhitespace(Ch))
+			{
+				FGlyphQuad& Quad = Label.Glyphs.AddDefaulted_GetRef();
+				const float Top = LineTop - Glyph.VerticalOffset * YScale;
+				Quad.Min = FVector2f(PenX, Top - SizeY);
+				Quad.Max = FVector2f(PenX + SizeX, Top);
+				Quad.UVMin = FVector2f(Glyph.StartU * InvAtlasWidth, Glyph.StartV * InvAtlasHeight);
+				Quad.UVMax = FVector2f((Glyph.StartU + Glyph.USize) * InvAtlasWidth, (Glyph.StartV + Glyph.VSize) * InvAtlasHeight);
+			}
+
+			PenX += SizeX + Source->HorizSpacingAdjust;
+			Previous = Ch;
+		}
+
+		// Horizontal alignment per line
+		float OffsetX = 0.0f;
+		switch (Source->HorizontalAlignment)
+		{
+			case EHTA_Center: OffsetX = -PenX * 0.5f; break;
+			case EHTA_Right:  OffsetX = -PenX; break;
+			default:          break;
+		}
+		for (int32 q = FirstQuad; q < Label.Glyphs.Num(); q++)
+		{
+			Label.Glyphs[q].Min.X += OffsetX;
+			Label.Glyphs[q].Max.X += OffsetX;
+		}
+
+		LineTop -= LineHeight;
+		LineStart = LineEnd + 1;
+	}
+
+	if (Label.Glyphs.Num() > Label.Capacity)
+	{
+		AllocateSlots(Label, Label.Glyphs.Num());
+	}
+}
+
+void UDiceLabelBatcher::WriteGeometry(FBatchedLabel& Label)
+{
+	FLabelBatch& Batch = Batches[Label.Batch];
+	const FTransform& Transform = Label.Transform;
+
+	// Text render space: the text faces +X, lines run along -Y, Z is up
+	const FVector Normal = Transform.GetUnitAxis(EAxis::X);
+	const FProcMeshTangent Tangent(-Transform.GetUnitAxis(EAxis::Y), false);
+
+	const int32 NumGlyphs = Label.bVisible ? Label.Glyphs.Num() : 0;
+	for (int32 g = 0; g < NumGlyphs; g++)
+	{
+		const FGlyphQuad& Quad = Label.Glyphs[g];
+		const int32 v = (Label.FirstGlyph + g) * 4;
+
+		// Top-left, top-right, bottom-left, bottom-right
+		Batch.Positions[v + 0] = Transform.TransformPosition(FVector(0.0f, -Quad.Min.X, Quad.Max.Y));
+		Batch.Positions[v + 1] = Transform.TransformPosition(FVector(0.0f, -Quad.Max.X, Quad.Max.Y));
+		Batch.Positions[v + 2] = Transform.TransformPosition(FVector(0.0f, -Quad.Min.X, Quad.Min.Y));
+		Batch.Positions[v + 3] = Transform.TransformPosition(FVector(0.0f, -Quad.Max.X, Quad.Min.Y));
+
+		Batch.UV0[v + 0] = FVector2D(Quad.UVMin.X, Quad.UVMin.Y);
+		Batch.UV0[v + 1] = FVector2D(Quad.UVMax.X, Quad.UVMin.Y);
+		Batch.UV0[v + 2] = FVector2D(Quad.UVMin.X, Quad.UVMax.Y);
+		Batch.UV0[v + 3] = FVector2D(Quad.UVMax.X, Quad.UVMax.Y);
+
+		for (int32 c = 0; c < 4; c++)
+		{
+			Batch.Normals[v + c] = Normal;
+			Batch.Tangents[v + c] = Tangent;
+		}
+	}
+
+	// Anything past the text (or all of it, when hidden) collapses
+	if (Label.Capacity > NumGlyphs)
+	{
+		CollapseSlots(Batch, Label.FirstGlyph + NumGlyphs, Label.Capacity - NumGlyphs);
+	}
+
+	INC_DWORD_STAT_BY(STAT_DiceLabelGlyphRewrites, Label.Capacity);
+	WriteColors(Label);
+}
+
+void UDiceLabelBatcher::WriteColors(FBatchedLabel& Label)
+{
+	FLabelBatch& Batch = Batches[Label.Batch];
+	const int32 First = Label.FirstGlyph * 4;
+	const int32 Last = First + Label.Glyphs.Num() * 4;
+	for (int32 v = First; v < Last; v++)
+	{
+		Batch.Colors[v] = Label.Color;
+	}
+	Batch.bDirty = true;
+}
+
+// ==================== UPLOAD ====================
+
+void UDiceLabelBatcher::Upload(int32 BatchIndex)
+{
+	FLabelBatch& Batch = Batches[BatchIndex];
+	Batch.bDirty = false;
+
+	if (Batch.bNeedsRecreate)
+	{
+		// Two triangles per slot, wound like a text render quad
+		Batch.Triangles.SetNumUninitialized(Batch.NumSlots * 6);
+		for (int32 s = 0; s < Batch.NumSlots; s++)
+		{
+			const int32 v = s * 4;
+			int32* Tri = &Batch.Triangles[s * 6];
+			Tri[0] = v + 0; Tri[1] = v + 3; Tri[2] = v + 1;
+			Tri[3] = v + 0; Tri[4] = v + 2; Tri[5] = v + 3;
+		}
+
+		MeshComponent->CreateMeshSection(BatchIndex, Batch.Positions, Batch.Triangles, Batch.Normals, Batch.UV0, Batch.Colors, Batch.Tangents, false);
+		MeshComponent->SetMaterial(BatchIndex, Batch.MID);
+		Batch.bNeedsRecreate = false;
+	}
+	else
+	{
+		MeshComponent->UpdateMeshSection(BatchIndex, Batch.Positions, Batch.Normals, Batch.UV0, Batch.Colors, Batch.Tangents);
+	}
+
+	INC_DWORD_STAT(STAT_DiceLabelBatchUploads);
+}
+
+void UDiceLabelBatcher::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_DiceLabelBatchUpdate);
+
+	for (auto It = Labels.CreateIterator(); It; ++It)
+	{
+		FBatchedLabel& Label = *It;
+		UTextRenderComponent* Source = Label.Source.Get();
+		if (!Source)
+		{
+			// Owner destroyed - hand the slots back
+			ReleaseSlots(Label);
+			for (auto LookupIt = LabelLookup.CreateIterator(); LookupIt; ++LookupIt)
+			{
+				if (LookupIt.Value() == It.GetIndex())
+				{
+					LookupIt.RemoveCurrent();
+					break;
+				}
+			}
+			It.RemoveCurrent();
+			continue;
+		}
+
+		UpdateLabel(Label, *Source);
+	}
+
+	UploadDirty();
+
+	SET_DWORD_STAT(STAT_DiceBatchedLabels, Labels.Num());
+}
+
+void UDiceLabelBatcher::UpdateLabel(FBatchedLabel& Label, const UTextRenderComponent& Source)
+{
+	// Visibility and placement come straight from the component. Adopted labels are hidden in game so the
+	// component itself never draws - read its own visible flag, which callers toggle through SetVisibility
+	const AActor* Owner = Source.GetOwner();
+	const bool bVisible = Source.GetVisibleFlag() && !(Owner && Owner->IsHidden());
+	if (bVisible != Label.bVisible)
+	{
+		Label.bVisible = bVisible;
+		Label.bGeometryDirty = true;
+	}
+
+	if (bVisible)
+	{
+		const FTransform& Transform = Source.GetComponentTransform();
+		if (!Transform.Equals(Label.Transform, KINDA_SMALL_NUMBER))
+		{
+			Label.Transform = Transform;
+			Label.bGeometryDirty = true;
+		}
+	}
+
+	if (Label.bLayoutDirty)
+	{
+		Layout(Label);
+		Label.bGeometryDirty = true;
+	}
+
+	if (Label.bGeometryDirty)
+	{
+		WriteGeometry(Label);
+	}
+	else if (Label.bColorDirty)
+	{
+		WriteColors(Label);
+	}
+
+	Label.bLayoutDirty = false;
+	Label.bGeometryDirty = false;
+	Label.bColorDirty = false;
+}
+
+void UDiceLabelBatcher::UploadDirty()
+{
+	for (int32 i = 0; i < Batches.Num(); i++)
+	{
+		if (Batches[i].bDirty || Batches[i].bNeedsRecreate)
+		{
+			if (Batches[i].NumSlots > 0)
+			{
+				Upload(i);
+			}
+		}
+	}
+}
+
+void UDiceLabelBatcher::RefreshLabelsOf(AActor* Owner)
+{
+	UDiceLabelBatcher* Batcher = Owner ? Get(Owner) : nullptr;
+	if (!Batcher)
+	{
+		return;
+	}
+
+	TInlineComponentArray<UTextRenderComponent*> Texts(Owner);
+	bool bAny = false;
+	for (UTextRenderComponent* Text : Texts)
+	{
+		if (FBatchedLabel* Batched = Batcher->FindLabel(Text))
+		{
+			Batcher->UpdateLabel(*Batched, *Text);
+			bAny = true;
+		}
+	}
+
+	if (bAny)
+	{
+		Batcher->UploadDirty();
+	}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProceduralMeshComponent.h"
+#include "DiceLabelBatcher.generated.h"
+
+class AActor;
+class UFont;
+class UTextRenderComponent;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+// Draws every adopted in-world label through one dynamic mesh section per font + material.
+// Adopted text render components stay in the scene as data (text, color, size, transform, visibility)
+// but are hidden themselves. Each frame only the glyph ranges of labels that changed are rewritten;
+// color and alpha live in vertex color, so fades never touch the glyph layout.
+// Route text/color/size changes through the static setters - they fall back to the component when it isn't batched.
+UCLASS()
+class UDiceLabelBatcher : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UDiceLabelBatcher();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UDiceLabelBatcher* Get(const UObject* WorldContext);
+
+	// Start drawing Label through the batch. Returns false (label left as-is) for fonts that can't be batched.
+	static bool Adopt(UTextRenderComponent* Label);
+
+	static void SetText(UTextRenderComponent* Label, const FText& Text);
+
+	// Per-frame variant for animated text: a batched label copies the characters into its own buffer and the
+	// component's Text is left as it was - finish with the FText overload to make the final text readable there
+	static void SetText(UTextRenderComponent* Label, FStringView Text);
+
+	static void SetColor(UTextRenderComponent* Label, FColor Color);
+	static void SetWorldSize(UTextRenderComponent* Label, float WorldSize);
+
+	// Re-sample Owner's labels now and upload what moved - for actors moved after the batcher ticked this frame
+	static void RefreshLabelsOf(AActor* Owner);
+
+	bool IsAdopted(const UTextRenderComponent* Label) const { return LabelLookup.Contains(Label); }
+
+	// Adopted labels are hidden in game, so their own WasRecentlyRendered is always false.
+	// This is the stand-in: the label is shown and the shared batch mesh drew within Tolerance seconds.
+	bool WasLabelRecentlyRendered(const UTextRenderComponent* Label, float Tolerance) const;
+
+	int32 GetNumBatches() const { return Batches.Num(); }
+	int32 GetNumLabels() const { return Labels.Num(); }
+
+private:
+	struct FGlyphQuad
+	{
+		FVector2f Min;    // Text space: X along the line, Y up
+		FVector2f Max;
+		FVector2f UVMin;
+		FVector2f UVMax;
+	};
+
+	struct FBatchedLabel
+	{
+		TWeakObjectPtr<UTextRenderComponent> Source;
+		FString Text;
+		FColor Color;
+		float WorldSize = 0.0f;
+		FTransform Transform;
+		bool bVisible = false;
+
+		int32 Batch = INDEX_NONE;
+		int32 FirstGlyph = 0;
+		int32 Capacity = 0;
+		TArray<FGlyphQuad> Glyphs;
+
+		bool bLayoutDirty = true;    // Text or size changed - re-run the glyph layout
+		bool bGeometryDirty = true;  // Transform or visibility changed - rewrite positions
+		bool bColorDirty = true;     // Only the vertex colors
+	};
+
+	struct FLabelBatch
+	{
+		UFont* Font = nullptr;
+		UMaterialInterface* Material = nullptr;
+		UMaterialInstanceDynamic* MID = nullptr;
+
+		TArray<FVector> Positions;
+		TArray<FVector> Normals;
+		TArray<FProcMeshTangent> Tangents;
+		TArray<FVector2D> UV0;
+		TArray<FColor> Colors;
+		TArray<int32> Triangles;
+
+		int32 NumSlots = 0;              // Glyph slots handed out (4 verts each)
+		TArray<FIntPoint> FreeRanges;    // (First, Capacity) returned by resized/destroyed labels
+		bool bNeedsRecreate = true;      // Slot count changed since the section was built
+		bool bDirty = false;
+	};
+
+	TSparseArray<FBatchedLabel> Labels;
+	TMap<TObjectKey<UTextRenderComponent>, int32> LabelLookup;
+	TArray<FLabelBatch> Batches;
+
+	UPROPERTY()
+	TObjectPtr<UProceduralMeshComponent> MeshComponent;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UMaterialInstanceDynamic>> BatchMaterials;
+
+	FBatchedLabel* FindLabel(const UTextRenderComponent* Label);
+	bool AdoptLabel(UTextRenderComponent* Label);
+	int32 FindOrAddBatch(UFont* Font, UMaterialInterface* Material);
+	bool EnsureMeshComponent();
+
+	void Layout(FBatchedLabel& Label);
+	void AllocateSlots(FBatchedLabel& Label, int32 NumGlyphs);
+	void ReleaseSlots(FBatchedLabel& Label);
+	void WriteGeometry(FBatchedLabel& Label);
+	void WriteColors(FBatchedLabel& Label);
+	void UpdateLabel(FBatchedLabel& Label, const UTextRenderComponent& Source);
+	void UploadDirty();
+	void CollapseSlots(FLabelBatch& Batch, int32 First, int32 Count);
+	void Upload(int32 BatchIndex);
+};
@@ -1,7 +1,14 @@
 #include "DiceModifier.h"
+#include "GGJ26.h"
 #include "Components/BoxComponent.h"
 #include "Components/TextRenderComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "DiceGameManager.h"
+#include "DiceSignificance.h"
+#include "DiceLabelBatcher.h"
+#include "DiceModifierTable.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Modifier Visual Pushes"), STAT_DiceModifierVisualPushes, STATGROUP_DiceGame);
 
 ADiceModifier::ADiceModifier()
 {
@@ -37,6 +44,10 @@ ADiceModifier::ADiceModifier()
 	ModifierText->SetTextRenderColor(FColor::White);
 
 	ModifierType = EModifierType::PlusOne;
+	Definition = nullptr;
+	TableRow = INDEX_NONE;
+	TableRowType = EModifierType::None;
+	TableRowDefinition = nullptr;
 	bIsUsed = false;
 	bIsHighlighted = false;
 	bIsInvalid = false;
@@ -66,10 +77,24 @@ void ADiceModifier::BeginPlay()
 	{
 		PlaneMesh->SetVisibility(false);
 	}
+	UDiceLabelBatcher::Adopt(ModifierText);
 	// Store base position for hover animation
 	BasePosition = GetActorLocation();
 	bBasePositionSet = true;
 	UpdateVisuals();
+
+	// Only the pop-in animates on the CPU - the highlight pulse lives in the material
+	if (UDiceSignificanceManager* Significance = UDiceSignificanceManager::Get(this))
+	{
+		Significance->Register(this, PrimaryActorTick, ModifierText, [this](EGamePhase)
+		{
+			if (bActivating)
+			{
+				return EDiceSignificance::High;
+			}
+			return EDiceSignificance::Dormant;
+		});
+	}
 }
 
 void ADiceModifier::Tick(float DeltaTime)
@@ -83,6 +108,7 @@ void ADiceModifier::Tick(float DeltaTime)
 		{
 			ActivationProgress = 1.0f;
 			bActivating = false;
+			UDiceSignificanceManager::RefreshFor(this);
 		}
 
 		float BounceScale = 0.5f + FMath::Sin(ActivationProgress * PI) * 0.15f;
@@ -95,18 +121,15 @@ void ADiceModifier::Tick(float DeltaTime)
 
 		UpdateVisuals();
 	}
-	else if (bIsHighlighted && !bIsUsed && bIsActive)
-	{
-		float Pulse = (FMath::Sin(GetWorld()->GetTimeSeconds() * 4.0f) + 1.0f) * 0.5f;
-		FVector NewScale = FVector(0.5f + Pulse * 0.05f, 0.5f + Pulse * 0.05f, 1.0f);
-		PlaneMesh->SetWorldScale3D(NewScale);
-	}
 }
 
 void ADiceModifier::SetHighlighted(bool bHighlight)
 {
 	if (bIsUsed || !bIsActive) return;
 
+	// Hover code calls this every frame while dragging - nothing to do unless the state moves
+	if (bIsHighlighted == bHighlight && (bHighlight || !bIsInvalid)) return;
+
 	bIsHighlighted = bHighlight;
 	if (!bHighlight)
 	{
@@ -114,11 +137,12 @@ void ADiceModifier::SetHighlighted(bool bHighlight)
 	}
 
 	UpdateVisuals();
+	UDiceSignificanceManager::RefreshFor(this);
 }
 
 void ADiceModifier::SetInvalid(bool bInvalid)
 {
-	if (bIsUsed || !bIsActive) return;
+	if (bIsUsed || !bIsActive || bIsInvalid == bInvalid) return;
 
 	bIsInvalid = bInvalid;
 	UpdateVisuals();
@@ -126,21 +150,7 @@ void ADiceModifier::SetInvalid(bool bInvalid)
 
 bool ADiceModifier::CanApplyToValue(int32 Value)
 {
-	switch (ModifierType)
-	{
-		case EModifierType::MinusOne:
-			return Value > 1;  // Can't go below 1
-		case EModifierType::PlusOne:
-			return Value < 6;  // Can't go above 6
-		case EModifierType::PlusTwo:
-			return Value <= 4;  // 5+2=7 and 6+2=8 are invalid (can't go above 6)
-		case EModifierType::Flip:
-		case EModifierType::RerollOne:
-		case EModifierType::RerollAll:
-			return true;  // Always valid
-		default:
-			return true;
-	}
+	return GetRow().CanApply(Value);
 }
 
 
@@ -156,6 +166,7 @@ void ADiceModifier::SetActive(bool bActive)
 
 	bIsActive = bActive;
 	UpdateVisuals();
+	UDiceSignificanceManager::RefreshFor(this);
 }
 
 void ADiceModifier::SetHidden(bool bHide)
@@ -180,44 +191,48 @@ void ADiceModifier::UseModifier()
 
 int32 ADiceModifier::ApplyToValue(int32 OriginalValue)
 {
-	switch (ModifierType)
-	{
-		case EModifierType::MinusOne:
-			return FMath::Max(1, OriginalValue - 1);
-		case EModifierType::PlusOne:
-			return FMath::Min(6, OriginalValue + 1);
-		case EModifierType::PlusTwo:
-			return FMath::Min(6, OriginalValue + 2);
-		case EModifierType::Flip:
-			return 7 - OriginalValue;
-		default:
-			return OriginalValue;
-	}
+	return GetRow().Apply(OriginalValue);
 }
 
 FString ADiceModifier::GetModifierDisplayText()
 {
-	switch (ModifierType)
+	return GetRow().Label.ToString();
+}
+
+const FText& ADiceModifier::GetModifierDisplayLabel() const
+{
+	// Shared FText per row - the label compares by identity, so re-applying it is free
+	return GetRow().Label;
+}
+
+const FDiceModifierRow& ADiceModifier::GetRow() const
+{
+	static const FDiceModifierRow Identity;
+
+	UDiceModifierTable* ResolvedTable = Table.Get();
+	if (!ResolvedTable)
+	{
+		ResolvedTable = UDiceModifierTable::Get(this);
+		if (!ResolvedTable)
+		{
+			return Identity;
+		}
+		Table = ResolvedTable;
+		TableRow = INDEX_NONE;
+	}
+
+	if (TableRow == INDEX_NONE || TableRowType != ModifierType || TableRowDefinition != Definition)
 	{
-		case EModifierType::MinusOne: return TEXT("-1");
-		case EModifierType::PlusOne: return TEXT("+1");
-		case EModifierType::PlusTwo: return TEXT("+2");
-		case EModifierType::Flip: return TEXT("FLIP");
-		case EModifierType::RerollOne: return TEXT("RE:1");
-		case EModifierType::RerollAll: return TEXT("RE:ALL");
-		case EModifierType::BonusHigher: return TEXT(">7");
-		case EModifierType::BonusLower: return TEXT("<7");
-		default: return TEXT("?");
+		TableRow = ResolvedTable->Resolve(Definition, ModifierType);
+		TableRowType = ModifierType;
+		TableRowDefinition = Definition;
 	}
+	return ResolvedTable->GetRow(TableRow);
 }
 
 bool ADiceModifier::RequiresDiceSelection()
 {
-	return ModifierType == EModifierType::MinusOne ||
-		   ModifierType == EModifierType::PlusOne ||
-		   ModifierType == EModifierType::PlusTwo ||
-		   ModifierType == EModifierType::Flip ||
-		   ModifierType == EModifierType::RerollOne;
+	return GetRow().bRequiresDiceSelection;
 }
 
 void ADiceModifier::UpdateBasePosition()
@@ -229,45 +244,73 @@ void ADiceModifier::UpdateBasePosition()
 
 void ADiceModifier::UpdateVisuals()
 {
-	// Respect hidden state - don't show anything if hidden
+	if (!ModifierText) return;
+
+	// Compare against what the label actually shows rather than a shadow copy -
+	// the game manager writes fades and Lucky!/Unlucky straight to the label
 	if (bIsHidden)
 	{
-		if (ModifierText) ModifierText->SetVisibility(false);
-		if (PlaneMesh) PlaneMesh->SetVisibility(false);
+		// Respect hidden state - don't show anything if hidden
+		if (ModifierText->GetVisibleFlag())
+		{
+			ModifierText->SetVisibility(false);
+			INC_DWORD_STAT(STAT_DiceModifierVisualPushes);
+		}
+		if (PlaneMesh && PlaneMesh->GetVisibleFlag())
+		{
+			PlaneMesh->SetVisibility(false);
+		}
 		return;
 	}
 
-	ModifierText->SetText(FText::FromString(GetModifierDisplayText()));
-	ModifierText->SetVisibility(true);
+	const FText& Label = GetModifierDisplayLabel();
+	if (!ModifierText->Text.IdenticalTo(Label))
+	{
+		UDiceLabelBatcher::SetText(ModifierText, Label);
+		INC_DWORD_STAT(STAT_DiceModifierVisualPushes);
+	}
+
+	if (!ModifierText->GetVisibleFlag())
+	{
+		ModifierText->SetVisibility(true);
+		INC_DWORD_STAT(STAT_DiceModifierVisualPushes);
+	}
 
 	// Always keep plane hidden
-	if (PlaneMesh)
+	if (PlaneMesh && PlaneMesh->GetVisibleFlag())
 	{
 		PlaneMesh->SetVisibility(false);
 	}
 
-	if (bIsUsed)
+	const FColor Color = GetStateColor();
+	if (ModifierText->TextRenderColor != Color)
 	{
-		ModifierText->SetTextRenderColor(FColor(50, 50, 50, 128));
+		UDiceLabelBatcher::SetColor(ModifierText, Color);
+		INC_DWORD_STAT(STAT_DiceModifierVisualPushes);
 	}
-	else if (!bIsActive)
+}
+
+FColor ADiceModifier::GetStateColor() const
+{
+	if (bIsUsed)
 	{
-		float Grey = 80;
-		ModifierText->SetTextRenderColor(FColor(Grey, Grey, Grey, 255));
+		return FColor(50, 50, 50, 128);
 	}
-	else if (bIsInvalid)
+	if (!bIsActive)
 	{
-		// Dark red for invalid (can't use with current dice value)
-		ModifierText->SetTextRenderColor(FColor(180, 50, 50, 255));
+		return FColor(80, 80, 80, 255);
 	}
-	else if (bIsHighlighted)
+	if (bIsInvalid)
 	{
-		ModifierText->SetTextRenderColor(FColor::Green);
+		// Dark red for invalid (can't use with current dice value)
+		return FColor(180, 50, 50, 255);
 	}
-	else
+	if (bIsHighlighted)
 	{
-		float Lerp = bActivating ? ActivationProgress : 1.0f;
-		uint8 ColorVal = FMath::Lerp(80, 255, Lerp);
-		ModifierText->SetTextRenderColor(FColor(ColorVal, ColorVal, ColorVal, 255));
+		return FColor::Green;
 	}
+
+	float Lerp = bActivating ? ActivationProgress : 1.0f;
+	uint8 ColorVal = FMath::Lerp(80, 255, Lerp);
+	return FColor(ColorVal, ColorVal, ColorVal, 255);
 }
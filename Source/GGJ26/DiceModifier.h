@@ -2,10 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "DiceModifierDefinition.h"
 #include "DiceModifier.generated.h"
 
 class UBoxComponent;
 class UTextRenderComponent;
+class UDiceModifierTable;
 
 UENUM(BlueprintType)
 enum class EModifierType : uint8
@@ -44,9 +46,14 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UTextRenderComponent* ModifierText;
 
+	// Picks the built-in behaviour, and marks the bonus round pair
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Modifier")
 	EModifierType ModifierType;
 
+	// Overrides the built-in behaviour for ModifierType when set
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier")
+	UDiceModifierDefinition* Definition;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Modifier")
 	bool bIsUsed;
 
@@ -86,16 +93,32 @@ public:
 	UFUNCTION(BlueprintCallable)
 	FString GetModifierDisplayText();
 
+	// Label text, compiled once per definition and shared by every modifier using it
+	const FText& GetModifierDisplayLabel() const;
+
+	// Compiled behaviour - validity and results per face, reroll and flip semantics
+	const FDiceModifierRow& GetRow() const;
+
 	UFUNCTION(BlueprintCallable)
 	bool RequiresDiceSelection();
 
 	UFUNCTION(BlueprintCallable)
 	void UpdateBasePosition();
 
+	// Push the current state to the label. Only properties that differ from what the
+	// label already shows are written, so this is cheap to call after any state change.
 	UFUNCTION(BlueprintCallable)
 	void UpdateVisuals();
 
 private:
+	// Row in UDiceModifierTable, resolved on first use and again if the type/definition is swapped
+	mutable TWeakObjectPtr<UDiceModifierTable> Table;
+	mutable int32 TableRow;
+	mutable EModifierType TableRowType;
+	mutable const UDiceModifierDefinition* TableRowDefinition;
+
+	FColor GetStateColor() const;
+
 	FLinearColor BaseColor;
 	FLinearColor HighlightColor;
 	FLinearColor UsedColor;
@@ -0,0 +1,53 @@
+#include "DiceModifierDefinition.h"
+
+UDiceModifierDefinition::UDiceModifierDefinition()
+{
+	DisplayText = FText::AsCultureInvariant(TEXT("?"));
+	Operation = EModifierOperation::Add;
+	Operand = 1;
+	OutOfRange = EModifierOutOfRange::Reject;
+	bRejectNoEffect = false;
+	bRequiresDiceSelection = true;
+	Reroll = EModifierReroll::None;
+}
+
+void UDiceModifierDefinition::Compile(FDiceModifierRow& OutRow) const
+{
+	OutRow.Results[0] = 0;
+	for (int32 Face = 1; Face <= 6; Face++)
+	{
+		int32 Result;
+		switch (Operation)
+		{
+			case EModifierOperation::Add: Result = Face + Operand; break;
+			case EModifierOperation::Multiply: Result = Face * Operand; break;
+			case EModifierOperation::Set: Result = Operand; break;
+			case EModifierOperation::Flip: Result = 7 - Face; break;
+			default: Result = Face; break;
+		}
+
+		bool bValid = true;
+		if (Result < 1 || Result > 6)
+		{
+			if (OutOfRange == EModifierOutOfRange::Clamp)
+			{
+				Result = FMath::Clamp(Result, 1, 6);
+			}
+			else
+			{
+				bValid = false;
+			}
+		}
+		if (bRejectNoEffect && Result == Face)
+		{
+			bValid = false;
+		}
+
+		OutRow.Results[Face] = bValid ? int8(Result) : 0;
+	}
+
+	OutRow.Reroll = Reroll;
+	OutRow.bRequiresDiceSelection = bRequiresDiceSelection;
+	OutRow.bFlip = (Operation == EModifierOperation::Flip);
+	OutRow.Label = DisplayText;
+}
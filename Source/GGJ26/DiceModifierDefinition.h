@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "DiceModifierDefinition.generated.h"
+
+UENUM(BlueprintType)
+enum class EModifierOperation : uint8
+{
+	None,      // Face stays as it is (rerolls, bonus picks)
+	Add,       // Face + Operand
+	Multiply,  // Face * Operand
+	Set,       // Operand
+	Flip       // Opposite face (7 - Face), plays the flip animation
+};
+
+UENUM(BlueprintType)
+enum class EModifierOutOfRange : uint8
+{
+	Reject,  // Can't be used on a face that would leave 1..6
+	Clamp    // Result is clamped to 1..6
+};
+
+UENUM(BlueprintType)
+enum class EModifierReroll : uint8
+{
+	None,
+	One,  // Throw the dropped die again
+	All   // Throw every unmatched die again
+};
+
+// One modifier compiled down to what the game actually asks of it
+struct FDiceModifierRow
+{
+	// Indexed by face 1..6 - 0 means the modifier can't be used on that face
+	int8 Results[7] = { 0, 1, 2, 3, 4, 5, 6 };
+
+	EModifierReroll Reroll = EModifierReroll::None;
+	bool bRequiresDiceSelection = false;
+	bool bFlip = false;
+	FText Label;
+
+	bool CanApply(int32 Face) const { return Face >= 1 && Face <= 6 && Results[Face] != 0; }
+	int32 Apply(int32 Face) const { return CanApply(Face) ? Results[Face] : Face; }
+};
+
+// Designer-facing modifier definition.
+// Assign one to a modifier actor to override its built-in behaviour - e.g. "x2 capped" is Multiply 2 with Clamp,
+// "set to 1" is Set 1. Compiled into UDiceModifierTable the first time a world uses it.
+UCLASS(BlueprintType)
+class UDiceModifierDefinition : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UDiceModifierDefinition();
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier")
+	FText DisplayText;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier")
+	EModifierOperation Operation;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier", meta = (EditCondition = "Operation == EModifierOperation::Add || Operation == EModifierOperation::Multiply || Operation == EModifierOperation::Set"))
+	int32 Operand;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier")
+	EModifierOutOfRange OutOfRange;
+
+	// Refuse faces the modifier would leave unchanged (e.g. "set to 1" on a 1)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier")
+	bool bRejectNoEffect;
+
+	// Has to be dropped onto a die (false = used on its own, like RE:ALL)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier")
+	bool bRequiresDiceSelection;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Modifier")
+	EModifierReroll Reroll;
+
+	void Compile(FDiceModifierRow& OutRow) const;
+};
@@ -0,0 +1,85 @@
+#include "DiceModifierTable.h"
+#include "GGJ26.h"
+#include "DiceModifier.h"
+#include "Engine/World.h"
+
+void UDiceModifierTable::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The behaviour the old per-type switches hard-coded
+	AddBuiltIn(EModifierType::None,        TEXT("?"),      EModifierOperation::None, 0,  EModifierReroll::None, false);
+	AddBuiltIn(EModifierType::MinusOne,    TEXT("-1"),     EModifierOperation::Add,  -1, EModifierReroll::None, true);
+	AddBuiltIn(EModifierType::PlusOne,     TEXT("+1"),     EModifierOperation::Add,  1,  EModifierReroll::None, true);
+	AddBuiltIn(EModifierType::PlusTwo,     TEXT("+2"),     EModifierOperation::Add,  2,  EModifierReroll::None, true);
+	AddBuiltIn(EModifierType::Flip,        TEXT("FLIP"),   EModifierOperation::Flip, 0,  EModifierReroll::None, true);
+	AddBuiltIn(EModifierType::RerollOne,   TEXT("RE:1"),   EModifierOperation::None, 0,  EModifierReroll::One,  true);
+	AddBuiltIn(EModifierType::RerollAll,   TEXT("RE:ALL"), EModifierOperation::None, 0,  EModifierReroll::All,  false);
+	AddBuiltIn(EModifierType::BonusHigher, TEXT(">7"),     EModifierOperation::None, 0,  EModifierReroll::None, false);
+	AddBuiltIn(EModifierType::BonusLower,  TEXT("<7"),     EModifierOperation::None, 0,  EModifierReroll::None, false);
+}
+
+void UDiceModifierTable::Deinitialize()
+{
+	Rows.Empty();
+	DefinitionRows.Empty();
+	Definitions.Empty();
+
+	Super::Deinitialize();
+}
+
+UDiceModifierTable* UDiceModifierTable::Get(const UObject* WorldContext)
+{
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDiceModifierTable>() : nullptr;
+}
+
+void UDiceModifierTable::AddBuiltIn(EModifierType Type, const TCHAR* Label, EModifierOperation Operation, int32 Operand,
+	EModifierReroll Reroll, bool bRequiresDiceSelection)
+{
+	UDiceModifierDefinition* Definition = NewObject<UDiceModifierDefinition>(this);
+	Definition->DisplayText = FText::AsCultureInvariant(Label);
+	Definition->Operation = Operation;
+	Definition->Operand = Operand;
+	Definition->OutOfRange = EModifierOutOfRange::Reject;
+	Definition->Reroll = Reroll;
+	Definition->bRequiresDiceSelection = bRequiresDiceSelection;
+	Definitions.Add(Definition);
+
+	const int32 RowIndex = int32(Type);
+	if (Rows.Num() <= RowIndex)
+	{
+		Rows.SetNum(RowIndex + 1);
+	}
+	Definition->Compile(Rows[RowIndex]);
+}
+
+// ==================== LOOKUP ====================
+
+int32 UDiceModifierTable::Resolve(const UDiceModifierDefinition* Definition, EModifierType Type)
+{
+	if (!Definition)
+	{
+		const int32 RowIndex = int32(Type);
+		return Rows.IsValidIndex(RowIndex) ? RowIndex : int32(EModifierType::None);
+	}
+
+	if (const int32* Found = DefinitionRows.Find(Definition))
+	{
+		return *Found;
+	}
+
+	const int32 RowIndex = Rows.AddDefaulted();
+	Definition->Compile(Rows[RowIndex]);
+	DefinitionRows.Add(Definition, RowIndex);
+	Definitions.Add(const_cast<UDiceModifierDefinition*>(Definition));
+
+	UE_LOG(LogDiceGame, Log, TEXT("Modifier table: compiled %s into row %d"), *Definition->GetName(), RowIndex);
+	return RowIndex;
+}
+
+const FDiceModifierRow& UDiceModifierTable::GetRow(int32 RowIndex) const
+{
+	static const FDiceModifierRow Identity;
+	return Rows.IsValidIndex(RowIndex) ? Rows[RowIndex] : Identity;
+}
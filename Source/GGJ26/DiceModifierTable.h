@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DiceModifierDefinition.h"
+#include "DiceModifierTable.generated.h"
+
+enum class EModifierType : uint8;
+
+// Every modifier in play compiled into one flat [modifier][face] table.
+// The first rows are the built-in EModifierType behaviours (row == enum value); definition assets are appended
+// the first time something resolves them. Validity and result are then a single array read.
+UCLASS()
+class UDiceModifierTable : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	static UDiceModifierTable* Get(const UObject* WorldContext);
+
+	// Row for Definition, or the built-in row for Type when there is no definition
+	int32 Resolve(const UDiceModifierDefinition* Definition, EModifierType Type);
+
+	const FDiceModifierRow& GetRow(int32 RowIndex) const;
+
+	int32 GetNumRows() const { return Rows.Num(); }
+
+private:
+	TArray<FDiceModifierRow> Rows;
+	TMap<const UDiceModifierDefinition*, int32> DefinitionRows;
+
+	// Built-ins plus every resolved asset, kept alive for as long as their rows are
+	UPROPERTY(Transient)
+	TArray<UDiceModifierDefinition*> Definitions;
+
+	void AddBuiltIn(EModifierType Type, const TCHAR* Label, EModifierOperation Operation, int32 Operand,
+		EModifierReroll Reroll, bool bRequiresDiceSelection);
+};
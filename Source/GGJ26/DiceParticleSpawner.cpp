@@ -1,7 +1,11 @@
 #include "DiceParticleSpawner.h"
+#include "GGJ26.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
 
+DECLARE_CYCLE_STAT(TEXT("Particle Spawn"), STAT_DiceParticleSpawn, STATGROUP_DiceGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Particle Pool Steals"), STAT_DiceParticlePoolSteals, STATGROUP_DiceGame);
+
 ADiceParticleSpawner* ADiceParticleSpawner::Instance = nullptr;
 
 ADiceParticleSpawner::ADiceParticleSpawner()
@@ -13,12 +17,26 @@ ADiceParticleSpawner::ADiceParticleSpawner()
 	MatchSystem = nullptr;
 	DamageSystem = nullptr;
 	ModifierSystem = nullptr;
+
+	// Dust/impact fire per die, the rest a few at a time
+	DustPoolSize = 12;
+	ImpactPoolSize = 12;
+	MatchPoolSize = 4;
+	DamagePoolSize = 2;
+	ModifierPoolSize = 4;
 }
 
 void ADiceParticleSpawner::BeginPlay()
 {
 	Super::BeginPlay();
 	Instance = this;
+
+	// Pre-warm every pool so the first spawn of a system costs the same as the hundredth
+	for (int32 i = 0; i < NumParticleTypes; i++)
+	{
+		const EParticleType Type = static_cast<EParticleType>(i);
+		CreatePool(Type, GetSystem(Type), GetPoolSize(Type));
+	}
 }
 
 ADiceParticleSpawner* ADiceParticleSpawner::GetInstance(UWorld* World)
@@ -42,99 +60,203 @@ ADiceParticleSpawner* ADiceParticleSpawner::GetInstance(UWorld* World)
 	return nullptr;
 }
 
-UNiagaraComponent* ADiceParticleSpawner::SpawnSystem(UNiagaraSystem* System, FVector Location, FRotator Rotation)
+UNiagaraSystem* ADiceParticleSpawner::GetSystem(EParticleType Type) const
 {
+	switch (Type)
+	{
+		case EParticleType::DiceDust: return DustSystem;
+		case EParticleType::DiceImpact: return ImpactSystem;
+		case EParticleType::DiceMatch: return MatchSystem;
+		case EParticleType::DiceDamage: return DamageSystem;
+		case EParticleType::ModifierActivate: return ModifierSystem;
+		default: return nullptr;
+	}
+}
+
+int32 ADiceParticleSpawner::GetPoolSize(EParticleType Type) const
+{
+	switch (Type)
+	{
+		case EParticleType::DiceDust: return DustPoolSize;
+		case EParticleType::DiceImpact: return ImpactPoolSize;
+		case EParticleType::DiceMatch: return MatchPoolSize;
+		case EParticleType::DiceDamage: return DamagePoolSize;
+		case EParticleType::ModifierActivate: return ModifierPoolSize;
+		default: return 0;
+	}
+}
+
+// ==================== POOLS ====================
+
+void ADiceParticleSpawner::CreatePool(EParticleType Type, UNiagaraSystem* System, int32 Size)
+{
+	FParticlePool& Pool = Pools[static_cast<int32>(Type)];
+	for (UNiagaraComponent* Old : Pool.Components)
+	{
+		PooledComponents.Remove(Old);
+		if (Old)
+		{
+			Old->DestroyComponent();
+		}
+	}
+	Pool = FParticlePool();
+	Pool.System = System;
 	if (!System)
 	{
-		return nullptr;
+		return;
+	}
+
+	for (int32 i = 0; i < Size; i++)
+	{
+		UNiagaraComponent* Comp = NewObject<UNiagaraComponent>(this);
+		Comp->SetAutoActivate(false);
+		Comp->SetAutoDestroy(false);
+		Comp->SetUsingAbsoluteLocation(true);
+		Comp->SetUsingAbsoluteRotation(true);
+		Comp->SetUsingAbsoluteScale(true);
+		Comp->SetAsset(System);
+		Comp->RegisterComponent();
+		Comp->InitializeSystem();
+
+		Pool.Components.Add(Comp);
+		PooledComponents.Add(Comp);
 	}
 
-	return UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-		GetWorld(),
-		System,
-		Location,
-		Rotation,
-		FVector(1.0f),
-		true,
-		true,
-		ENCPoolMethod::AutoRelease
-	);
+	// Resolve the parameter bindings once. Unpooled systems resolve against the asset's exposed parameters.
+	const FNiagaraUserRedirectionParameterStore& Params = Pool.Components.Num() > 0
+		? Pool.Components[0]->GetOverrideParameters()
+		: System->GetExposedParameters();
+
+	const FNiagaraVariable ColorParam(FNiagaraTypeDefinition::GetColorDef(), FName(TEXT("User.Color")));
+	const FNiagaraVariable ScaleParam(FNiagaraTypeDefinition::GetFloatDef(), FName(TEXT("User.Scale")));
+	const FNiagaraVariable IntensityParam(FNiagaraTypeDefinition::GetFloatDef(), FName(TEXT("User.Intensity")));
+	if (Params.IndexOf(ColorParam) != INDEX_NONE) Pool.ColorParam = ColorParam;
+	if (Params.IndexOf(ScaleParam) != INDEX_NONE) Pool.ScaleParam = ScaleParam;
+	if (Params.IndexOf(IntensityParam) != INDEX_NONE) Pool.IntensityParam = IntensityParam;
 }
 
-void ADiceParticleSpawner::SpawnParticleAt(FVector Location, EParticleType Type, FLinearColor Color, float Scale)
+UNiagaraComponent* ADiceParticleSpawner::Acquire(FParticlePool& Pool)
 {
-	UNiagaraSystem* SystemToUse = nullptr;
+	if (Pool.Components.Num() == 0)
+	{
+		// Unpooled - fall back to Niagara's own world pool
+		return UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+			GetWorld(),
+			Pool.System,
+			FVector::ZeroVector,
+			FRotator::ZeroRotator,
+			FVector(1.0f),
+			true,
+			false,
+			ENCPoolMethod::AutoRelease
+		);
+	}
 
-	switch (Type)
+	// First free component from the oldest on; if they are all playing, restart the oldest
+	const int32 Num = Pool.Components.Num();
+	int32 Index = Pool.Next;
+	for (int32 Step = 0; Step < Num; Step++)
 	{
-		case EParticleType::DiceDust:
-			SystemToUse = DustSystem;
-			break;
-		case EParticleType::DiceImpact:
-			SystemToUse = ImpactSystem;
-			break;
-		case EParticleType::DiceMatch:
-			SystemToUse = MatchSystem;
-			break;
-		case EParticleType::DiceDamage:
-			SystemToUse = DamageSystem;
-			break;
-		case EParticleType::ModifierActivate:
-			SystemToUse = ModifierSystem;
+		const int32 Candidate = (Pool.Next + Step) % Num;
+		if (!Pool.Components[Candidate]->IsActive())
+		{
+			Index = Candidate;
 			break;
+		}
+		if (Step == Num - 1)
+		{
+			INC_DWORD_STAT(STAT_DiceParticlePoolSteals);
+		}
+	}
+
+	Pool.Next = (Index + 1) % Num;
+	return Pool.Components[Index];
+}
+
+void ADiceParticleSpawner::Fire(EParticleType Type, const FVector& Location, const FLinearColor& Color, TOptional<float> Scale, TOptional<float> Intensity)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DiceParticleSpawn);
+
+	const int32 TypeIndex = static_cast<int32>(Type);
+	if (TypeIndex < 0 || TypeIndex >= NumParticleTypes)
+	{
+		return;
 	}
+	FParticlePool& Pool = Pools[TypeIndex];
 
-	UNiagaraComponent* Comp = SpawnSystem(SystemToUse, Location);
-	if (Comp)
+	// The systems are BlueprintReadWrite - rebuild the pool if one was assigned or swapped since BeginPlay
+	UNiagaraSystem* System = GetSystem(Type);
+	if (System != Pool.System)
+	{
+		CreatePool(Type, System, GetPoolSize(Type));
+	}
+	if (!Pool.System)
 	{
-		Comp->SetVariableLinearColor(FName("Color"), Color);
-		Comp->SetVariableFloat(FName("Scale"), Scale);
+		return;
 	}
+
+	UNiagaraComponent* Comp = Acquire(Pool);
+	if (!Comp)
+	{
+		return;
+	}
+
+	// Only parameters the system exposes are written
+	FNiagaraUserRedirectionParameterStore& Params = Comp->GetOverrideParameters();
+	if (Pool.ColorParam.IsSet())
+	{
+		Params.SetParameterValue(Color, Pool.ColorParam.GetValue());
+	}
+	if (Scale.IsSet() && Pool.ScaleParam.IsSet())
+	{
+		Params.SetParameterValue(Scale.GetValue(), Pool.ScaleParam.GetValue());
+	}
+	if (Intensity.IsSet() && Pool.IntensityParam.IsSet())
+	{
+		Params.SetParameterValue(Intensity.GetValue(), Pool.IntensityParam.GetValue());
+	}
+
+	Comp->SetWorldLocationAndRotation(Location, FRotator::ZeroRotator);
+	Comp->Activate(true);
+}
+
+// ==================== SPAWNING ====================
+
+void ADiceParticleSpawner::SpawnParticleAt(FVector Location, EParticleType Type, FLinearColor Color, float Scale)
+{
+	Fire(Type, Location, Color, Scale);
 }
 
 void ADiceParticleSpawner::SpawnDustAt(FVector Location, float Intensity)
 {
-	UNiagaraComponent* Comp = SpawnSystem(DustSystem, Location);
-	if (Comp)
-	{
-		Comp->SetVariableFloat(FName("Intensity"), Intensity);
-		Comp->SetVariableLinearColor(FName("Color"), FLinearColor(0.8f, 0.7f, 0.6f, 1.0f));
-	}
+	Fire(EParticleType::DiceDust, Location, FLinearColor(0.8f, 0.7f, 0.6f, 1.0f), {}, Intensity);
 }
 
 void ADiceParticleSpawner::SpawnImpactAt(FVector Location, FLinearColor Color)
 {
-	UNiagaraComponent* Comp = SpawnSystem(ImpactSystem, Location);
-	if (Comp)
-	{
-		Comp->SetVariableLinearColor(FName("Color"), Color);
-	}
+	Fire(EParticleType::DiceImpact, Location, Color);
 }
 
 void ADiceParticleSpawner::SpawnMatchEffect(FVector Location)
 {
-	UNiagaraComponent* Comp = SpawnSystem(MatchSystem, Location);
-	if (Comp)
-	{
-		Comp->SetVariableLinearColor(FName("Color"), FLinearColor(0.2f, 1.0f, 0.3f, 1.0f));
-	}
+	Fire(EParticleType::DiceMatch, Location, FLinearColor(0.2f, 1.0f, 0.3f, 1.0f));
 }
 
 void ADiceParticleSpawner::SpawnDamageEffect(FVector Location, bool bIsEnemy)
 {
-	UNiagaraComponent* Comp = SpawnSystem(DamageSystem, Location);
-	if (Comp)
-	{
-		FLinearColor Color = bIsEnemy ? FLinearColor(1.0f, 0.3f, 0.2f, 1.0f) : FLinearColor(0.2f, 0.5f, 1.0f, 1.0f);
-		Comp->SetVariableLinearColor(FName("Color"), Color);
-	}
+	FLinearColor Color = bIsEnemy ? FLinearColor(1.0f, 0.3f, 0.2f, 1.0f) : FLinearColor(0.2f, 0.5f, 1.0f, 1.0f);
+	Fire(EParticleType::DiceDamage, Location, Color);
 }
 
 void ADiceParticleSpawner::SpawnModifierEffect(FVector Location, FLinearColor Color)
 {
-	UNiagaraComponent* Comp = SpawnSystem(ModifierSystem, Location);
-	if (Comp)
+	Fire(EParticleType::ModifierActivate, Location, Color);
+}
+
+void ADiceParticleSpawner::SpawnMany(const TArray<FVector>& Locations, EParticleType Type, FLinearColor Color, float Scale)
+{
+	for (const FVector& Location : Locations)
 	{
-		Comp->SetVariableLinearColor(FName("Color"), Color);
+		Fire(Type, Location, Color, Scale);
 	}
 }
@@ -13,7 +13,8 @@ enum class EParticleType : uint8
 	DiceImpact,
 	DiceMatch,
 	DiceDamage,
-	ModifierActivate
+	ModifierActivate,
+	Count UMETA(Hidden)  // Keep last - sizes the pool array
 };
 
 UCLASS()
@@ -41,6 +42,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Particles")
 	UNiagaraSystem* ModifierSystem;
 
+	// Components created and initialized per system at BeginPlay. 0 = spawn from the global Niagara pool each time.
+	// When every component is busy the oldest effect is restarted at the new location.
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = "0"))
+	int32 DustPoolSize;
+
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = "0"))
+	int32 ImpactPoolSize;
+
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = "0"))
+	int32 MatchPoolSize;
+
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = "0"))
+	int32 DamagePoolSize;
+
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = "0"))
+	int32 ModifierPoolSize;
+
 	UFUNCTION(BlueprintCallable, Category = "Particles")
 	void SpawnParticleAt(FVector Location, EParticleType Type, FLinearColor Color = FLinearColor::White, float Scale = 1.0f);
 
@@ -59,10 +77,37 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Particles")
 	void SpawnModifierEffect(FVector Location, FLinearColor Color);
 
+	// Fire-and-forget batch - one effect per location (e.g. dust under every die that lands this frame)
+	UFUNCTION(BlueprintCallable, Category = "Particles")
+	void SpawnMany(const TArray<FVector>& Locations, EParticleType Type, FLinearColor Color = FLinearColor::White, float Scale = 1.0f);
+
 	static ADiceParticleSpawner* GetInstance(UWorld* World);
 
 private:
 	static ADiceParticleSpawner* Instance;
 
-	UNiagaraComponent* SpawnSystem(UNiagaraSystem* System, FVector Location, FRotator Rotation = FRotator::ZeroRotator);
+	static constexpr int32 NumParticleTypes = static_cast<int32>(EParticleType::Count);
+
+	struct FParticlePool
+	{
+		UNiagaraSystem* System = nullptr;
+		TArray<UNiagaraComponent*> Components;
+		int32 Next = 0;  // Oldest component - where the search for a free one starts
+
+		// User parameters the system actually exposes, resolved once
+		TOptional<FNiagaraVariable> ColorParam;
+		TOptional<FNiagaraVariable> ScaleParam;
+		TOptional<FNiagaraVariable> IntensityParam;
+	};
+	FParticlePool Pools[NumParticleTypes];
+
+	// Keeps the pooled components alive - Pools only points at them
+	UPROPERTY(Transient)
+	TArray<UNiagaraComponent*> PooledComponents;
+
+	void CreatePool(EParticleType Type, UNiagaraSystem* System, int32 Size);
+	UNiagaraComponent* Acquire(FParticlePool& Pool);
+	void Fire(EParticleType Type, const FVector& Location, const FLinearColor& Color, TOptional<float> Scale = {}, TOptional<float> Intensity = {});
+	UNiagaraSystem* GetSystem(EParticleType Type) const;
+	int32 GetPoolSize(EParticleType Type) const;
 };
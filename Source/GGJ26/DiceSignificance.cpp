@@ -0,0 +1,304 @@
+#include "DiceSignificance.h"
+#include "GGJ26.h"
+#include "DiceGameManager.h"
+#include "DiceCamera.h"
+#include "DiceLabelBatcher.h"
+#include "Components/TextRenderComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+static TAutoConsoleVariable<bool> CVarDiceSignificanceEnable(
+	TEXT("dice.Significance.Enable"),
+	true,
+	TEXT("Throttle cosmetic ticks by significance. Off = everything ticks every frame (to compare)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceFrameBudgetMs(
+	TEXT("dice.Significance.BudgetMs"),
+	16.67f,
+	TEXT("Frame time budget for the governor. Sustained frames over this throttle cosmetic ticks and effects further."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceFarDistance(
+	TEXT("dice.Significance.FarDistance"),
+	2000.0f,
+	TEXT("Cosmetic tickers further than this from the camera drop one significance step."),
+	ECVF_Default);
+
+static constexpr float EvaluateInterval = 0.1f;
+static constexpr int32 MaxPressure = 3;
+static constexpr float OverBudgetHold = 0.5f;   // Seconds over budget before raising pressure
+static constexpr float UnderBudgetHold = 2.0f;  // Seconds comfortably under budget before easing off
+
+UDiceSignificanceManager::UDiceSignificanceManager()
+{
+	EvaluateTimer = 0.0f;
+	SmoothedFrameMs = 0.0f;
+	OverBudgetTime = 0.0f;
+	UnderBudgetTime = 0.0f;
+	Pressure = 0;
+	CosmeticScale = 1.0f;
+}
+
+void UDiceSignificanceManager::Deinitialize()
+{
+	Entries.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UDiceSignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDiceSignificanceManager, STATGROUP_Tickables);
+}
+
+UDiceSignificanceManager* UDiceSignificanceManager::Get(const UObject* WorldContext)
+{
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDiceSignificanceManager>() : nullptr;
+}
+
+float UDiceSignificanceManager::CosmeticScaleFor(const UObject* WorldContext)
+{
+	UDiceSignificanceManager* Manager = Get(WorldContext);
+	return Manager ? Manager->GetCosmeticScale() : 1.0f;
+}
+
+// ==================== REGISTRATION ====================
+
+void UDiceSignificanceManager::Register(UObject* Owner, FTickFunction& TickFunction, USceneComponent* Visual, FRelevanceFunc&& Relevance)
+{
+	if (!Owner || !Relevance) return;
+
+	Unregister(Owner);
+
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Owner = Owner;
+	Entry.TickFunction = &TickFunction;
+	Entry.Visual = Visual;
+	Entry.Relevance = MoveTemp(Relevance);
+}
+
+void UDiceSignificanceManager::Unregister(UObject* Owner)
+{
+	Entries.RemoveAllSwap([Owner](const FEntry& Entry) { return Entry.Owner.Get() == Owner; });
+}
+
+void UDiceSignificanceManager::Refresh(UObject* Owner)
+{
+	FVector ViewLocation = FVector::ZeroVector;
+	ADiceCamera* Cam = ADiceCamera::Get(this);
+	if (Cam)
+	{
+		ViewLocation = Cam->GetActorLocation();
+	}
+
+	for (FEntry& Entry : Entries)
+	{
+		if (Entry.Owner.Get() == Owner)
+		{
+			Evaluate(Entry, GetPhase(), ViewLocation, Cam != nullptr);
+			return;
+		}
+	}
+}
+
+void UDiceSignificanceManager::RefreshFor(UObject* Owner)
+{
+	if (UDiceSignificanceManager* Manager = Get(Owner))
+	{
+		Manager->Refresh(Owner);
+	}
+}
+
+// ==================== EVALUATION ====================
+
+float UDiceSignificanceManager::GetTickInterval(EDiceSignificance Significance)
+{
+	switch (Significance)
+	{
+		case EDiceSignificance::Medium:  return 1.0f / 30.0f;
+		case EDiceSignificance::Low:     return 1.0f / 15.0f;
+		case EDiceSignificance::Dormant: return 0.25f;
+		default:                         return 0.0f;
+	}
+}
+
+EGamePhase UDiceSignificanceManager::GetPhase()
+{
+	if (!GameManager.IsValid())
+	{
+		UWorld* World = GetWorld();
+		if (World)
+		{
+			for (TActorIterator<ADiceGameManager> It(World); It; ++It)
+			{
+				GameManager = *It;
+				break;
+			}
+		}
+	}
+	return GameManager.IsValid() ? GameManager->CurrentPhase : EGamePhase::Idle;
+}
+
+void UDiceSignificanceManager::Evaluate(FEntry& Entry, EGamePhase Phase, const FVector& ViewLocation, bool bHasView)
+{
+	if (!Entry.TickFunction->IsTickFunctionRegistered()) return;
+
+	EDiceSignificance Significance = Entry.Relevance(Phase);
+
+	if (!CVarDiceSignificanceEnable.GetValueOnGameThread())
+	{
+		Significance = EDiceSignificance::Critical;
+	}
+	else if (Significance != EDiceSignificance::Critical)
+	{
+		USceneComponent* Visual = Entry.Visual.Get();
+		if (Visual)
+		{
+			// Nothing to animate if nobody can see it
+			if (!IsOnScreen(Visual))
+			{
+				Significance = EDiceSignificance::Dormant;
+			}
+			else if (bHasView && FVector::DistSquared(Visual->GetComponentLocation(), ViewLocation) > FMath::Square(CVarDiceFarDistance.GetValueOnGameThread()))
+			{
+				Significance = (EDiceSignificance)FMath::Min((int32)Significance + 1, (int32)EDiceSignificance::Dormant);
+			}
+		}
+
+		// Governor pressure - High can be pushed down too, Critical never
+		Significance = (EDiceSignificance)FMath::Min((int32)Significance + Pressure, (int32)EDiceSignificance::Dormant);
+	}
+
+	if (Significance != Entry.Current)
+	{
+		Entry.Current = Significance;
+		Entry.TickFunction->UpdateTickIntervalAndCoolDown(GetTickInterval(Significance));
+	}
+}
+
+bool UDiceSignificanceManager::IsOnScreen(const USceneComponent* Visual) const
+{
+	// A label drawn by the batcher is hidden itself - ask the batcher whether its batch is on screen
+	if (const UTextRenderComponent* Text = Cast<UTextRenderComponent>(Visual))
+	{
+		const UDiceLabelBatcher* Batcher = UDiceLabelBatcher::Get(this);
+		if (Batcher && Batcher->IsAdopted(Text))
+		{
+			return Batcher->WasLabelRecentlyRendered(Text, 0.25f);
+		}
+	}
+
+	const UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Visual);
+	return Primitive ? Primitive->WasRecentlyRendered(0.25f) : (Visual->GetOwner() && Visual->GetOwner()->WasRecentlyRendered(0.25f));
+}
+
+void UDiceSignificanceManager::DumpEntries() const
+{
+	static const TCHAR* Names[] = { TEXT("Critical"), TEXT("High"), TEXT("Medium"), TEXT("Low"), TEXT("Dormant") };
+
+	UE_LOG(LogDiceGame, Log, TEXT("Significance: %d entries, pressure %d"), Entries.Num(), Pressure);
+	for (const FEntry& Entry : Entries)
+	{
+		const USceneComponent* Visual = Entry.Visual.Get();
+		UE_LOG(LogDiceGame, Log, TEXT("  %-32s %-24s on screen %-3s %s"),
+			*GetNameSafe(Entry.Owner.Get()), *GetNameSafe(Visual),
+			Visual ? (IsOnScreen(Visual) ? TEXT("yes") : TEXT("no")) : TEXT("-"),
+			Names[FMath::Clamp((int32)Entry.Current, 0, 4)]);
+	}
+}
+
+static FAutoConsoleCommandWithWorld CmdDiceSignificanceDump(
+	TEXT("dice.Significance.Dump"),
+	TEXT("Log every significance entry with whether its visual counts as on screen and its current rating. An on-screen modifier or round timer should not read Dormant."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UDiceSignificanceManager* Significance = World ? World->GetSubsystem<UDiceSignificanceManager>() : nullptr)
+		{
+			Significance->DumpEntries();
+		}
+	}));
+
+void UDiceSignificanceManager::EvaluateAll()
+{
+	Entries.RemoveAllSwap([](const FEntry& Entry) { return !Entry.Owner.IsValid(); });
+	if (Entries.Num() == 0) return;
+
+	const EGamePhase Phase = GetPhase();
+
+	FVector ViewLocation = FVector::ZeroVector;
+	ADiceCamera* Cam = ADiceCamera::Get(this);
+	if (Cam)
+	{
+		ViewLocation = Cam->GetActorLocation();
+	}
+
+	for (FEntry& Entry : Entries)
+	{
+		Evaluate(Entry, Phase, ViewLocation, Cam != nullptr);
+	}
+}
+
+// ==================== GOVERNOR ====================
+
+void UDiceSignificanceManager::UpdateGovernor()
+{
+	// Real frame time, not dilated game time
+	const float FrameMs = FApp::GetDeltaTime() * 1000.0f;
+	SmoothedFrameMs = SmoothedFrameMs <= 0.0f ? FrameMs : FMath::Lerp(SmoothedFrameMs, FrameMs, 0.1f);
+
+	const float BudgetMs = FMath::Max(CVarDiceFrameBudgetMs.GetValueOnGameThread(), 1.0f);
+	const float DeltaSeconds = FrameMs * 0.001f;
+
+	if (SmoothedFrameMs > BudgetMs * 1.05f)
+	{
+		UnderBudgetTime = 0.0f;
+		OverBudgetTime += DeltaSeconds;
+		if (OverBudgetTime >= OverBudgetHold && Pressure < MaxPressure)
+		{
+			Pressure++;
+			OverBudgetTime = 0.0f;
+			UE_LOG(LogDiceGame, Log, TEXT("Frame governor: %.1f ms over %.1f ms budget - cosmetic pressure %d"), SmoothedFrameMs, BudgetMs, Pressure);
+		}
+	}
+	else if (SmoothedFrameMs < BudgetMs * 0.8f)
+	{
+		OverBudgetTime = 0.0f;
+		UnderBudgetTime += DeltaSeconds;
+		if (UnderBudgetTime >= UnderBudgetHold && Pressure > 0)
+		{
+			Pressure--;
+			UnderBudgetTime = 0.0f;
+			UE_LOG(LogDiceGame, Log, TEXT("Frame governor: back to %.1f ms - cosmetic pressure %d"), SmoothedFrameMs, Pressure);
+		}
+	}
+	else
+	{
+		OverBudgetTime = 0.0f;
+		UnderBudgetTime = 0.0f;
+	}
+
+	if (!CVarDiceSignificanceEnable.GetValueOnGameThread())
+	{
+		Pressure = 0;
+	}
+
+	CosmeticScale = 1.0f - 0.25f * Pressure;
+}
+
+void UDiceSignificanceManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UpdateGovernor();
+
+	EvaluateTimer += DeltaTime;
+	if (EvaluateTimer >= EvaluateInterval)
+	{
+		EvaluateTimer = 0.0f;
+		EvaluateAll();
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DiceSignificance.generated.h"
+
+class ADiceGameManager;
+class USceneComponent;
+enum class EGamePhase : uint8;
+
+// How much a cosmetic ticker matters right now
+enum class EDiceSignificance : uint8
+{
+	Critical,  // Drives gameplay - every frame, never throttled
+	High,      // Being looked at / interacted with - every frame unless over budget
+	Medium,    // 30 Hz
+	Low,       // 15 Hz
+	Dormant    // 4 Hz
+};
+
+// Significance manager for ambient/cosmetic ticks.
+// Re-rates each registered tick function from visibility, camera distance and the owner's relevance to the current phase,
+// and runs a frame-time governor: over budget it demotes everything non-critical and scales cosmetic effects down.
+// Gameplay-critical ticks (manager, hands, camera rig) are simply never registered.
+UCLASS()
+class UDiceSignificanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UDiceSignificanceManager();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UDiceSignificanceManager* Get(const UObject* WorldContext);
+
+	using FRelevanceFunc = TFunction<EDiceSignificance(EGamePhase)>;
+
+	// Start rating Owner's tick function. Visual has to be on screen for the owner to matter.
+	// Entries for destroyed owners are dropped automatically.
+	void Register(UObject* Owner, FTickFunction& TickFunction, USceneComponent* Visual, FRelevanceFunc&& Relevance);
+	void Unregister(UObject* Owner);
+
+	// Owner's state just changed (highlight, animation start) - re-rate it now instead of on the next pass
+	void Refresh(UObject* Owner);
+	static void RefreshFor(UObject* Owner);
+
+	// 1 within budget, lower under sustained overload - multiply blood splatter counts, glitch chances etc. by this
+	float GetCosmeticScale() const { return CosmeticScale; }
+	static float CosmeticScaleFor(const UObject* WorldContext);
+
+	int32 GetPressure() const { return Pressure; }
+
+	// Log every entry with its visibility and current rating (dice.Significance.Dump)
+	void DumpEntries() const;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<UObject> Owner;
+		FTickFunction* TickFunction = nullptr;
+		TWeakObjectPtr<USceneComponent> Visual;
+		FRelevanceFunc Relevance;
+		EDiceSignificance Current = EDiceSignificance::High;
+	};
+	TArray<FEntry> Entries;
+
+	TWeakObjectPtr<ADiceGameManager> GameManager;
+
+	float EvaluateTimer;
+
+	// Governor
+	float SmoothedFrameMs;
+	float OverBudgetTime;
+	float UnderBudgetTime;
+	int32 Pressure;  // Each level demotes non-critical entries one step
+	float CosmeticScale;
+
+	void UpdateGovernor();
+	void EvaluateAll();
+	void Evaluate(FEntry& Entry, EGamePhase Phase, const FVector& ViewLocation, bool bHasView);
+	EGamePhase GetPhase();
+	bool IsOnScreen(const USceneComponent* Visual) const;
+
+	static float GetTickInterval(EDiceSignificance Significance);
+};
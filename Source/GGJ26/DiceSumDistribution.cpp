@@ -0,0 +1,354 @@
+#include "DiceSumDistribution.h"
+#include "GGJ26.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Dice Sum Table Build"), STAT_DiceSumTableBuild, STATGROUP_DiceGame);
+
+static TAutoConsoleVariable<float> CVarDiceRollMaxExactWork(
+	TEXT("dice.Roll.MaxExactWork"),
+	4.0e8f,
+	TEXT("Largest table build (in multiply-adds, ~2 x width^2) the exact sum sampler will do. Bigger pools roll every die instead."),
+	ECVF_Default);
+
+// A 53-bit uniform draw resolves probabilities down to ~1e-16, so totals this unlikely can never be
+// sampled anyway. Trimming them keeps every table about 21 sigma wide.
+static constexpr double TailEpsilon = 1.0e-24;
+
+// The handful of pool sizes a session uses - cleared wholesale when it overflows
+static constexpr int32 MaxCachedDistributions = 16;
+
+static TMap<uint64, TSharedPtr<const FDiceSumDistribution>> GDistributionCache;
+
+// Direct convolution of two trimmed distributions. Every term is positive, so there is no cancellation
+// (unlike an FFT) and each probability stays accurate to a few ulps.
+static void Convolve(const TArray<double>& A, int32 ALow, const TArray<double>& B, int32 BLow, TArray<double>& Out, int32& OutLow)
+{
+	TArray<double> Result;
+	Result.SetNumZeroed(A.Num() + B.Num() - 1);
+	for (int32 i = 0; i < A.Num(); i++)
+	{
+		const double Weight = A[i];
+		double* Row = Result.GetData() + i;
+		for (int32 j = 0; j < B.Num(); j++)
+		{
+			Row[j] += Weight * B[j];
+		}
+	}
+
+	// Drop the tails no 53-bit draw can reach
+	int32 Front = 0;
+	while (Front < Result.Num() - 1 && Result[Front] < TailEpsilon)
+	{
+		Front++;
+	}
+	int32 Back = Result.Num() - 1;
+	while (Back > Front && Result[Back] < TailEpsilon)
+	{
+		Back--;
+	}
+
+	Out.Reset();
+	Out.Append(Result.GetData() + Front, Back - Front + 1);
+	OutLow = ALow + BLow + Front;
+}
+
+FDiceSumDistribution::FDiceSumDistribution(int32 InNumDice, int32 InSides)
+	: NumDice(InNumDice)
+	, Sides(InSides)
+	, MinTotal(0)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DiceSumTableBuild);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Binary exponentiation of the single-die distribution: O(log N) convolutions of tables ~21 sigma wide
+	TArray<double> Base;
+	Base.Init(1.0 / Sides, Sides);
+	int32 BaseLow = 1;
+
+	bool bHaveResult = false;
+	for (int32 Remaining = NumDice; Remaining > 0; )
+	{
+		if (Remaining & 1)
+		{
+			if (bHaveResult)
+			{
+				Convolve(Pmf, MinTotal, Base, BaseLow, Pmf, MinTotal);
+			}
+			else
+			{
+				Pmf = Base;
+				MinTotal = BaseLow;
+				bHaveResult = true;
+			}
+		}
+
+		Remaining >>= 1;
+		if (Remaining > 0)
+		{
+			Convolve(Base, BaseLow, Base, BaseLow, Base, BaseLow);
+		}
+	}
+
+	Cdf.SetNumUninitialized(Pmf.Num());
+	double Running = 0.0;
+	for (int32 i = 0; i < Pmf.Num(); i++)
+	{
+		Running += Pmf[i];
+		Cdf[i] = Running;
+	}
+
+	UE_LOG(LogDiceGame, Log, TEXT("Dice sum table %dd%d: %d totals kept (%d..%d), mass %.17g, built in %.2f ms"),
+		NumDice, Sides, Pmf.Num(), GetMinTotal(), GetMaxTotal(), Running, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+TSharedPtr<const FDiceSumDistribution> FDiceSumDistribution::Get(int32 NumDice, int32 Sides)
+{
+	check(IsInGameThread());
+
+	if (NumDice < 1 || Sides < 2)
+	{
+		return nullptr;
+	}
+
+	const uint64 Key = (uint64(uint32(NumDice)) << 32) | uint32(Sides);
+	if (const TSharedPtr<const FDiceSumDistribution>* Found = GDistributionCache.Find(Key))
+	{
+		return *Found;
+	}
+
+	// Squaring and multiplying costs about twice the square of the final width
+	const double Sigma = FMath::Sqrt(double(NumDice) * (double(Sides) * Sides - 1.0) / 12.0);
+	const double Width = FMath::Min(double(NumDice) * (Sides - 1) + 1.0, 22.0 * Sigma + Sides);
+	const double Work = 2.0 * Width * Width;
+	if (Work > CVarDiceRollMaxExactWork.GetValueOnGameThread())
+	{
+		return nullptr;
+	}
+
+	if (GDistributionCache.Num() >= MaxCachedDistributions)
+	{
+		GDistributionCache.Empty();
+	}
+
+	TSharedPtr<const FDiceSumDistribution> Distribution = MakeShareable(new FDiceSumDistribution(NumDice, Sides));
+	GDistributionCache.Add(Key, Distribution);
+	return Distribution;
+}
+
+// ==================== SAMPLING ====================
+
+void FDiceRandom64::GenerateNewSeed()
+{
+	State = FPlatformTime::Cycles64() ^ (uint64(FPlatformTime::Cycles()) << 32) ^ uint64(FMath::Rand());
+	State = Next();  // Stir so close timestamps give unrelated streams
+}
+
+int32 FDiceSumDistribution::Sample(FDiceRandom64& Rng) const
+{
+	// Scale by the retained mass so the trimmed tails can never be hit
+	const double Target = Rng.UniformDouble() * Cdf.Last();
+	const int32 Index = FMath::Min(int32(Algo::UpperBound(Cdf, Target)), Cdf.Num() - 1);
+	return MinTotal + Index;
+}
+
+double FDiceSumDistribution::GetProbability(int32 Total) const
+{
+	const int32 Index = Total - MinTotal;
+	return Pmf.IsValidIndex(Index) ? Pmf[Index] : 0.0;
+}
+
+int32 FDiceSumDistribution::SampleExact(int32 NumDice, int32 Sides, FDiceRandom64& Rng)
+{
+	if (NumDice <= 0)
+	{
+		return 0;
+	}
+	Sides = FMath::Max(Sides, 2);
+
+	if (TSharedPtr<const FDiceSumDistribution> Distribution = Get(NumDice, Sides))
+	{
+		return Distribution->Sample(Rng);
+	}
+
+	// Too big to tabulate - still exact, just O(N)
+	int32 Total = 0;
+	for (int32 i = 0; i < NumDice; i++)
+	{
+		Total += Rng.RandRange(1, Sides);
+	}
+	return Total;
+}
+
+int32 FDiceSumDistribution::SampleNormal(int32 NumDice, int32 Sides, FDiceRandom64& Rng)
+{
+	if (NumDice <= 0)
+	{
+		return 0;
+	}
+	Sides = FMath::Max(Sides, 2);
+
+	const double Mean = NumDice * (Sides + 1) * 0.5;
+	const double Sigma = FMath::Sqrt(double(NumDice) * (double(Sides) * Sides - 1.0) / 12.0);
+
+	// Box-Muller
+	const double U1 = 1.0 - Rng.UniformDouble();  // (0, 1] - keeps the log finite
+	const double U2 = Rng.UniformDouble();
+	const double Z = FMath::Sqrt(-2.0 * FMath::Loge(U1)) * FMath::Cos(2.0 * UE_DOUBLE_PI * U2);
+
+	const int64 Total = FMath::RoundToInt64(Mean + Z * Sigma);
+	return int32(FMath::Clamp<int64>(Total, NumDice, int64(NumDice) * Sides));
+}
+
+// ==================== VERIFICATION ====================
+
+// Table vs brute-force enumeration of every outcome for small pools
+static double VerifyAgainstEnumeration(int32 NumDice, int32 Sides)
+{
+	TSharedPtr<const FDiceSumDistribution> Distribution = FDiceSumDistribution::Get(NumDice, Sides);
+	if (!Distribution)
+	{
+		return -1.0;
+	}
+
+	TArray<int64> Counts;
+	Counts.SetNumZeroed(NumDice * Sides + 1);
+	TArray<int32> Faces;
+	Faces.Init(1, NumDice);
+	int64 Outcomes = 0;
+	for (;;)
+	{
+		int32 Total = 0;
+		for (int32 Face : Faces)
+		{
+			Total += Face;
+		}
+		Counts[Total]++;
+		Outcomes++;
+
+		// Odometer step
+		int32 Digit = 0;
+		while (Digit < NumDice && ++Faces[Digit] > Sides)
+		{
+			Faces[Digit] = 1;
+			Digit++;
+		}
+		if (Digit == NumDice)
+		{
+			break;
+		}
+	}
+
+	double MaxRelativeError = 0.0;
+	for (int32 Total = NumDice; Total <= NumDice * Sides; Total++)
+	{
+		const double Expected = double(Counts[Total]) / double(Outcomes);
+		const double Error = FMath::Abs(Distribution->GetProbability(Total) - Expected) / Expected;
+		MaxRelativeError = FMath::Max(MaxRelativeError, Error);
+	}
+	return MaxRelativeError;
+}
+
+static void VerifyDiceSumSampler(int32 NumDice, int32 Sides, int32 Samples)
+{
+	// 1) The convolution matches exact enumeration
+	bool bEnumerationPassed = true;
+	for (int32 N = 1; N <= 4; N++)
+	{
+		if (FMath::Pow(double(Sides), double(N)) > 2.0e6)
+		{
+			break;
+		}
+		const double Error = VerifyAgainstEnumeration(N, Sides);
+		const bool bPassed = Error >= 0.0 && Error < 1.0e-12;
+		bEnumerationPassed &= bPassed;
+		UE_LOG(LogDiceGame, Log, TEXT("Dice sum verify: %dd%d table vs enumeration max relative error %.3g %s"),
+			N, Sides, Error, bPassed ? TEXT("PASS") : TEXT("FAIL"));
+	}
+
+	TSharedPtr<const FDiceSumDistribution> Distribution = FDiceSumDistribution::Get(NumDice, Sides);
+	if (!Distribution)
+	{
+		UE_LOG(LogDiceGame, Warning, TEXT("Dice sum verify: %dd%d is over dice.Roll.MaxExactWork - nothing to sample"), NumDice, Sides);
+		return;
+	}
+
+	// 2) Chi-square goodness of fit of the sampler against the table. Fixed seed so a failure can be replayed.
+	FDiceRandom64 Rng(0x5EED);
+	TArray<int32> Histogram;
+	Histogram.SetNumZeroed(Distribution->GetMaxTotal() - Distribution->GetMinTotal() + 1);
+	double Mean = 0.0;
+
+	uint64 Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Samples; i++)
+	{
+		const int32 Total = Distribution->Sample(Rng);
+		Histogram[Total - Distribution->GetMinTotal()]++;
+		Mean += Total;
+	}
+	const double ExactNs = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Start) * 1.0e9 / Samples;
+	Mean /= Samples;
+
+	// Merge neighbouring totals until every bin expects at least 5 hits
+	double ChiSquare = 0.0;
+	int32 Bins = 0;
+	double BinExpected = 0.0;
+	int64 BinObserved = 0;
+	for (int32 i = 0; i < Histogram.Num(); i++)
+	{
+		BinExpected += Distribution->GetProbability(Distribution->GetMinTotal() + i) * Samples;
+		BinObserved += Histogram[i];
+		if (BinExpected >= 5.0 || i == Histogram.Num() - 1)
+		{
+			if (BinExpected > 0.0)
+			{
+				ChiSquare += FMath::Square(BinObserved - BinExpected) / BinExpected;
+				Bins++;
+			}
+			BinExpected = 0.0;
+			BinObserved = 0;
+		}
+	}
+
+	// Wilson-Hilferty critical value at p = 0.001
+	const double Dof = FMath::Max(1, Bins - 1);
+	const double Critical = Dof * FMath::Pow(1.0 - 2.0 / (9.0 * Dof) + 3.090 * FMath::Sqrt(2.0 / (9.0 * Dof)), 3.0);
+	const double ExpectedMean = NumDice * (Sides + 1) * 0.5;
+
+	UE_LOG(LogDiceGame, Log, TEXT("Dice sum verify: %dd%d, %d samples, %d bins: chi2 %.1f (critical %.1f at p=0.001) %s, mean %.3f (expected %.3f)"),
+		NumDice, Sides, Samples, Bins, ChiSquare, Critical, ChiSquare < Critical ? TEXT("PASS") : TEXT("FAIL"), Mean, ExpectedMean);
+
+	// 3) Cost per roll against rolling every die and the normal approximation
+	const int32 LoopSamples = FMath::Clamp(int32(2.0e7 / NumDice), 1, Samples);
+	int64 Checksum = 0;
+	Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < LoopSamples; i++)
+	{
+		for (int32 d = 0; d < NumDice; d++)
+		{
+			Checksum += Rng.RandRange(1, Sides);
+		}
+	}
+	const double LoopNs = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Start) * 1.0e9 / LoopSamples;
+
+	Start = FPlatformTime::Cycles64();
+	for (int32 i = 0; i < Samples; i++)
+	{
+		Checksum += FDiceSumDistribution::SampleNormal(NumDice, Sides, Rng);
+	}
+	const double NormalNs = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Start) * 1.0e9 / Samples;
+
+	UE_LOG(LogDiceGame, Log, TEXT("Dice sum verify: per roll - table %.1f ns, per-die loop %.1f ns, normal approximation %.1f ns [checksum %lld]%s"),
+		ExactNs, LoopNs, NormalNs, Checksum, bEnumerationPassed ? TEXT("") : TEXT(" - ENUMERATION FAILED"));
+}
+
+static FAutoConsoleCommandWithArgs CmdDiceRollVerify(
+	TEXT("dice.Roll.Verify"),
+	TEXT("Check the exact dice sum sampler against enumeration and a chi-square fit, and time it. Usage: dice.Roll.Verify [NumDice=10000] [Sides=6] [Samples=1000000]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumDice = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000;
+		const int32 Sides = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 6;
+		const int32 Samples = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 1000000;
+		VerifyDiceSumSampler(FMath::Max(NumDice, 1), FMath::Max(Sides, 2), FMath::Max(Samples, 100));
+	}));
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// SplitMix64. FRandomStream keeps only 32 bits of state, so two of its draws can't make a 53-bit uniform -
+// the second is fixed by the first. One 64-bit output here fills the whole mantissa.
+struct FDiceRandom64
+{
+	FDiceRandom64() : State(0) {}
+	explicit FDiceRandom64(uint64 Seed) : State(Seed) {}
+
+	void Initialize(uint64 Seed) { State = Seed; }
+	void GenerateNewSeed();
+
+	uint64 Next()
+	{
+		uint64 Z = (State += 0x9E3779B97F4A7C15ull);
+		Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+		return Z ^ (Z >> 31);
+	}
+
+	// Uniform double in [0, 1) from the top 53 bits of one output
+	double UniformDouble() { return double(Next() >> 11) * (1.0 / 9007199254740992.0); }
+
+	// Uniform integer in [Min, Max] by multiply-shift - bias under (Max - Min) / 2^32
+	int32 RandRange(int32 Min, int32 Max)
+	{
+		const uint64 Range = uint64(int64(Max) - Min + 1);
+		return Min + int32(((Next() >> 32) * Range) >> 32);
+	}
+
+private:
+	uint64 State;
+};
+
+// Exact distribution of the sum of NumDice fair dice with Sides sides.
+// Built once per (NumDice, Sides) by convolving the single-die distribution with itself (binary exponentiation)
+// and cached; a roll is then one uniform draw and a binary search over the CDF, so even 10,000 dice cost O(log N).
+// Only totals rarer than 1e-24 are dropped - far below what a 53-bit uniform draw can resolve.
+class FDiceSumDistribution
+{
+public:
+	// Cached distribution, or null when building it would be too expensive (see dice.Roll.MaxExactWork)
+	static TSharedPtr<const FDiceSumDistribution> Get(int32 NumDice, int32 Sides);
+
+	// Exact sample - uses the cached table when there is one, otherwise rolls every die
+	static int32 SampleExact(int32 NumDice, int32 Sides, FDiceRandom64& Rng);
+
+	// Normal approximation (mean N(S+1)/2, variance N(S^2-1)/12), rounded and clamped. O(1), no table.
+	static int32 SampleNormal(int32 NumDice, int32 Sides, FDiceRandom64& Rng);
+
+	int32 Sample(FDiceRandom64& Rng) const;
+
+	// Probability of rolling exactly Total
+	double GetProbability(int32 Total) const;
+
+	int32 GetNumDice() const { return NumDice; }
+	int32 GetSides() const { return Sides; }
+	int32 GetMinTotal() const { return MinTotal; }
+	int32 GetMaxTotal() const { return MinTotal + Pmf.Num() - 1; }
+
+private:
+	FDiceSumDistribution(int32 InNumDice, int32 InSides);
+
+	int32 NumDice;
+	int32 Sides;
+	int32 MinTotal;       // Total of Pmf[0] (above NumDice once the low tail is trimmed)
+	TArray<double> Pmf;
+	TArray<double> Cdf;   // Running sum of Pmf - Cdf.Last() is the retained mass
+};
@@ -0,0 +1,316 @@
+#include "DiceTextRevealComponent.h"
+#include "GGJ26.h"
+#include "Components/TextRenderComponent.h"
+#include "GameFramework/Actor.h"
+#include "DiceSignificance.h"
+#include "DiceLabelBatcher.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Text Reveal Pushes"), STAT_DiceTextRevealPushes, STATGROUP_DiceGame);
+
+UDiceTextRevealComponent::UDiceTextRevealComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	Mode = ETextRevealMode::Typewriter;
+	CharsPerSecond = 15.0f;
+	OutSpeedScale = 1.0f;
+	GlitchChance = 0.0f;
+	OutGlitchScale = 1.5f;  // More glitchy when typing out
+	GlitchDuration = 0.04f;
+	GlitchChars = TEXT("@#$%&*!?<>[]{}|/\\");
+	ScrambleChars = TEXT("#@$%&*?!");
+	RandomSeed = 0;
+
+	Label = nullptr;
+	Elapsed = 0.0f;
+	NextKey = 0;
+	VisibleCount = 0;
+	bPlaying = false;
+	bTypingOut = false;
+	bScrambleTail = false;
+	bLabelTextStale = false;
+	NumTextPushes = 0;
+}
+
+UDiceTextRevealComponent* UDiceTextRevealComponent::FindOrCreate(AActor* Owner, UTextRenderComponent* Label)
+{
+	if (!Owner || !Label) return nullptr;
+
+	TArray<UDiceTextRevealComponent*> Reveals;
+	Owner->GetComponents<UDiceTextRevealComponent>(Reveals);
+	for (UDiceTextRevealComponent* Reveal : Reveals)
+	{
+		if (Reveal->Label == Label || !Reveal->Label)
+		{
+			Reveal->SetLabel(Label);
+			return Reveal;
+		}
+	}
+
+	UDiceTextRevealComponent* Reveal = NewObject<UDiceTextRevealComponent>(Owner);
+	Reveal->SetLabel(Label);
+	Owner->AddInstanceComponent(Reveal);
+	Reveal->RegisterComponent();
+	return Reveal;
+}
+
+void UDiceTextRevealComponent::SetLabel(UTextRenderComponent* InLabel)
+{
+	if (Label == InLabel) return;
+
+	SyncLabelText();
+
+	Label = InLabel;
+	DisplayedText = Label ? Label->Text.ToString() : FString();
+}
+
+// ==================== PLAYBACK ====================
+
+void UDiceTextRevealComponent::RevealIn(const FString& Text)
+{
+	FullText = Text;
+
+	const float Interval = 1.0f / FMath::Max(CharsPerSecond, KINDA_SMALL_NUMBER);
+	if (Mode == ETextRevealMode::Scramble)
+	{
+		BuildScramble(Interval);
+	}
+	else
+	{
+		BuildTypewriter(0, FullText.Len(), Interval, GlitchChance);
+	}
+
+	Play(false);
+}
+
+void UDiceTextRevealComponent::RevealOut()
+{
+	const float Interval = 1.0f / FMath::Max(CharsPerSecond * OutSpeedScale, KINDA_SMALL_NUMBER);
+	BuildTypewriter(FMath::Min(VisibleCount, FullText.Len()), 0, Interval, GlitchChance * OutGlitchScale);
+
+	Play(true);
+}
+
+void UDiceTextRevealComponent::Stop()
+{
+	bPlaying = false;
+	SetComponentTickEnabled(false);
+	SyncLabelText();
+}
+
+void UDiceTextRevealComponent::SyncLabelText()
+{
+	// One text per reveal, when it comes to rest - readers of the component see the final string
+	if (bLabelTextStale && Label)
+	{
+		UDiceLabelBatcher::SetText(Label, FText::FromString(DisplayedText));
+	}
+	bLabelTextStale = false;
+}
+
+void UDiceTextRevealComponent::Clear()
+{
+	ShowText(TEXT(""));
+	VisibleCount = 0;
+}
+
+void UDiceTextRevealComponent::ShowText(const TCHAR* Text)
+{
+	bPlaying = false;
+	SetComponentTickEnabled(false);
+
+	if (!Label || FCString::Strcmp(*DisplayedText, Text) == 0)
+	{
+		SyncLabelText();
+		return;
+	}
+
+	bLabelTextStale = false;  // Replaced below
+	DisplayedText = Text;
+	UDiceLabelBatcher::SetText(Label, FText::FromString(DisplayedText));
+
+	NumTextPushes++;
+	INC_DWORD_STAT(STAT_DiceTextRevealPushes);
+}
+
+void UDiceTextRevealComponent::Play(bool bOut)
+{
+	Elapsed = 0.0f;
+	NextKey = 0;
+	bTypingOut = bOut;
+	bPlaying = true;
+
+	// Whatever is keyed at time zero shows right away
+	Advance(0.0f);
+
+	if (bPlaying)
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UDiceTextRevealComponent::Advance(float DeltaTime)
+{
+	Elapsed += DeltaTime;
+
+	// Only the last key crossed this frame is drawn
+	int32 FireKey = INDEX_NONE;
+	while (NextKey < Keys.Num() && Keys[NextKey].Time <= Elapsed)
+	{
+		FireKey = NextKey;
+		VisibleCount = Keys[NextKey].VisibleCount;
+		NextKey++;
+	}
+
+	if (FireKey != INDEX_NONE)
+	{
+		ApplyKey(Keys[FireKey]);
+	}
+
+	if (NextKey >= Keys.Num())
+	{
+		Stop();
+		OnRevealFinished.Broadcast(bTypingOut);
+	}
+}
+
+void UDiceTextRevealComponent::ApplyKey(const FRevealKey& Key)
+{
+	if (!Label)
+	{
+		return;
+	}
+
+	// Consecutive keys can spell the same thing (e.g. a glitch that picked the original glyph)
+	BuildFrame(Key);
+	if (Scratch.Equals(DisplayedText, ESearchCase::CaseSensitive))
+	{
+		return;
+	}
+
+	// Both buffers keep their reserved size - swapping them never allocates
+	Swap(Scratch, DisplayedText);
+	UDiceLabelBatcher::SetText(Label, FStringView(DisplayedText));
+	bLabelTextStale = true;
+
+	NumTextPushes++;
+	INC_DWORD_STAT(STAT_DiceTextRevealPushes);
+}
+
+void UDiceTextRevealComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (bPlaying)
+	{
+		Advance(DeltaTime);
+	}
+}
+
+// ==================== KEY SCHEDULE ====================
+
+void UDiceTextRevealComponent::ResetKeys(int32 ExpectedKeys)
+{
+	Keys.Reset(ExpectedKeys);
+
+	// Room for the whole text plus a trailing glitch glyph - frames are rewritten in place from here on
+	const int32 Capacity = FullText.Len() + 2;
+	Scratch.Reset(Capacity);
+	DisplayedText.Reserve(Capacity);
+
+	Stream.Initialize(RandomSeed != 0 ? RandomSeed : FMath::Rand());
+	bScrambleTail = false;
+}
+
+UDiceTextRevealComponent::FRevealKey& UDiceTextRevealComponent::AddKey(float Time, int32 Visible)
+{
+	FRevealKey& Key = Keys.AddDefaulted_GetRef();
+	Key.Time = Time;
+	Key.VisibleCount = Visible;
+	return Key;
+}
+
+void UDiceTextRevealComponent::BuildTypewriter(int32 From, int32 To, float Interval, float Glitch)
+{
+	const int32 Steps = FMath::Abs(To - From);
+	ResetKeys(Steps * 2 + 1);
+
+	// Fewer glitches when the frame governor is under pressure
+	Glitch *= UDiceSignificanceManager::CosmeticScaleFor(this);
+	const bool bCanGlitch = Glitch > 0.0f && GlitchChars.Len() > 0;
+
+	AddKey(0.0f, From);
+
+	const int32 Direction = To > From ? 1 : -1;
+	float Time = 0.0f;
+	for (int32 Visible = From + Direction; Steps > 0; Visible += Direction)
+	{
+		Time += Interval;
+
+		// Flash a glitched copy of this step before it settles
+		if (bCanGlitch && Visible > 0 && Stream.FRand() < Glitch)
+		{
+			FRevealKey& GlitchKey = AddKey(Time, Visible);
+			GlitchKey.GlitchIndex = Stream.RandRange(0, Visible - 1);
+			GlitchKey.GlitchChar = GlitchChars[Stream.RandRange(0, GlitchChars.Len() - 1)];
+			if (Stream.FRand() < 0.3f)
+			{
+				GlitchKey.ExtraChar = GlitchChars[Stream.RandRange(0, GlitchChars.Len() - 1)];
+			}
+
+			// The next character waits for the glitch to clear
+			AddKey(Time + GlitchDuration, Visible);
+			Time += FMath::Max(0.0f, GlitchDuration - Interval);
+		}
+		else
+		{
+			AddKey(Time, Visible);
+		}
+
+		if (Visible == To)
+		{
+			break;
+		}
+	}
+}
+
+void UDiceTextRevealComponent::BuildScramble(float Interval)
+{
+	const int32 Len = FullText.Len();
+	ResetKeys(Len + 1);
+	bScrambleTail = true;
+
+	// One key per revealed glyph - the scrambled tail re-rolls with each step, not each render frame
+	for (int32 Revealed = 0; Revealed <= Len; Revealed++)
+	{
+		AddKey(Revealed * Interval, Revealed).ScrambleSeed = int32(Stream.GetUnsignedInt());
+	}
+}
+
+void UDiceTextRevealComponent::BuildFrame(const FRevealKey& Key)
+{
+	const int32 Len = FullText.Len();
+	const int32 Visible = FMath::Clamp(Key.VisibleCount, 0, Len);
+
+	Scratch.Reset();
+	Scratch.Append(*FullText, Visible);
+
+	if (bScrambleTail)
+	{
+		FRandomStream TailStream(Key.ScrambleSeed);
+		for (int32 i = Visible; i < Len; i++)
+		{
+			Scratch.AppendChar(ScrambleChars.Len() > 0 ? ScrambleChars[TailStream.RandRange(0, ScrambleChars.Len() - 1)] : TEXT(' '));
+		}
+	}
+
+	if (Scratch.IsValidIndex(Key.GlitchIndex))
+	{
+		Scratch[Key.GlitchIndex] = Key.GlitchChar;
+	}
+	if (Key.ExtraChar != 0)
+	{
+		Scratch.AppendChar(Key.ExtraChar);
+	}
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "DiceTextRevealComponent.generated.h"
+
+class UTextRenderComponent;
+
+UENUM(BlueprintType)
+enum class ETextRevealMode : uint8
+{
+	Typewriter,  // Characters appear one at a time
+	Scramble     // Full length from the start, unrevealed characters shown as random glyphs
+};
+
+// bTypedOut = the reveal that just finished was RevealOut
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnTextRevealFinished, bool);
+
+// Drives a text render component through a typewriter / scramble reveal.
+// A reveal is scheduled from a seeded stream when it starts as compact keys (time, visible count, glitch).
+// When a key fires the frame is rewritten in place in a buffer reserved for the full text and pushed to the
+// label only if the visible string actually changed - no allocation per character or per frame.
+// Ticks only while a reveal is playing.
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class UDiceTextRevealComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UDiceTextRevealComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	// The reveal driving Label on Owner - added at runtime if there is none yet
+	static UDiceTextRevealComponent* FindOrCreate(AActor* Owner, UTextRenderComponent* Label);
+
+	// Settings
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	ETextRevealMode Mode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	float CharsPerSecond;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	float OutSpeedScale;  // Typing out speed relative to CharsPerSecond
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	float GlitchChance;  // Chance per typed character to flash a glitch (0-1)
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	float OutGlitchScale;  // Glitch chance multiplier when typing out
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	float GlitchDuration;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	FString GlitchChars;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	FString ScrambleChars;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reveal")
+	int32 RandomSeed;  // 0 = fresh seed every reveal
+
+	// Functions
+	void SetLabel(UTextRenderComponent* InLabel);
+	UTextRenderComponent* GetLabel() const { return Label; }
+
+	UFUNCTION(BlueprintCallable)
+	void RevealIn(const FString& Text);
+
+	// Type out whatever is currently visible
+	UFUNCTION(BlueprintCallable)
+	void RevealOut();
+
+	// Stop any reveal and blank the label
+	UFUNCTION(BlueprintCallable)
+	void Clear();
+
+	// Freeze on the current frame
+	UFUNCTION(BlueprintCallable)
+	void Stop();
+
+	// Stop any reveal and show Text as-is (no-op if it is already showing)
+	void ShowText(const TCHAR* Text);
+
+	bool IsRevealing() const { return bPlaying; }
+	bool IsTypingOut() const { return bPlaying && bTypingOut; }
+	int32 GetVisibleCount() const { return VisibleCount; }
+	const FString& GetFullText() const { return FullText; }
+	int32 GetNumTextPushes() const { return NumTextPushes; }
+
+	FOnTextRevealFinished OnRevealFinished;
+
+private:
+	UTextRenderComponent* Label;
+
+	struct FRevealKey
+	{
+		float Time = 0.0f;
+		int32 VisibleCount = 0;
+		int32 GlitchIndex = INDEX_NONE;  // Character swapped for GlitchChar
+		TCHAR GlitchChar = 0;
+		TCHAR ExtraChar = 0;             // Glitch glyph trailing the text, 0 = none
+		int32 ScrambleSeed = 0;          // Scramble mode - seeds the random tail
+	};
+
+	// Built when a reveal starts
+	TArray<FRevealKey> Keys;
+	FString Scratch;  // Frame under construction - swapped with DisplayedText when it differs
+	FRandomStream Stream;
+	bool bScrambleTail;
+
+	FString FullText;
+	float Elapsed;
+	int32 NextKey;
+	int32 VisibleCount;
+	bool bPlaying;
+	bool bTypingOut;
+
+	// What the label shows. While a reveal plays the batched label holds only the characters;
+	// bLabelTextStale means the component's own Text still needs the final string.
+	FString DisplayedText;
+	bool bLabelTextStale;
+	int32 NumTextPushes;
+
+	void ResetKeys(int32 ExpectedKeys);
+	void BuildTypewriter(int32 From, int32 To, float Interval, float Glitch);
+	void BuildScramble(float Interval);
+	FRevealKey& AddKey(float Time, int32 Visible);
+	void Play(bool bOut);
+	void Advance(float DeltaTime);
+	void ApplyKey(const FRevealKey& Key);
+	void BuildFrame(const FRevealKey& Key);
+	void SyncLabelText();
+};
@@ -0,0 +1,308 @@
+#include "DiceTimeline.h"
+#include "GGJ26.h"
+#include "Algo/BinarySearch.h"
+
+DECLARE_CYCLE_STAT(TEXT("Timeline Advance"), STAT_DiceTimelineAdvance, STATGROUP_DiceGame);
+
+namespace
+{
+	// Index of the last key at or before Time (0 if Time is before the first key).
+	// Walks from the previous cursor, so a playhead that only moves forward pays O(1) amortized.
+	template <typename KeyType>
+	int32 SeekCursor(const TArray<KeyType>& Keys, int32 Cursor, float Time)
+	{
+		Cursor = FMath::Clamp(Cursor, 0, FMath::Max(0, Keys.Num() - 1));
+		while (Cursor > 0 && Keys[Cursor].Time > Time)
+		{
+			Cursor--;
+		}
+		while (Cursor + 1 < Keys.Num() && Keys[Cursor + 1].Time <= Time)
+		{
+			Cursor++;
+		}
+		return Cursor;
+	}
+
+	template <typename KeyType>
+	int32 FindCursor(const TArray<KeyType>& Keys, float Time)
+	{
+		const int32 Upper = Algo::UpperBoundBy(Keys, Time, [](const KeyType& Key) { return Key.Time; });
+		return FMath::Max(0, Upper - 1);
+	}
+
+	// Eased 0..1 position between the cursor key and the next one
+	template <typename KeyType>
+	float SegmentAlpha(const TArray<KeyType>& Keys, int32 Cursor, float Time)
+	{
+		if (Cursor + 1 >= Keys.Num() || Time <= Keys[Cursor].Time)
+		{
+			return 0.0f;
+		}
+
+		const KeyType& To = Keys[Cursor + 1];
+		const float Span = To.Time - Keys[Cursor].Time;
+		const float Alpha = Span > KINDA_SMALL_NUMBER ? FMath::Clamp((Time - Keys[Cursor].Time) / Span, 0.0f, 1.0f) : 1.0f;
+		return UDiceTimelineAsset::ApplyEase(To.Ease, Alpha);
+	}
+
+	float SampleFloat(const TArray<FDiceTimelineFloatKey>& Keys, int32 Cursor, float Time)
+	{
+		if (Cursor + 1 >= Keys.Num())
+		{
+			return Keys[Cursor].Value;
+		}
+		return FMath::Lerp(Keys[Cursor].Value, Keys[Cursor + 1].Value, SegmentAlpha(Keys, Cursor, Time));
+	}
+
+	template <typename KeyType>
+	void SortByTime(TArray<KeyType>& Keys)
+	{
+		Keys.StableSort([](const KeyType& A, const KeyType& B) { return A.Time < B.Time; });
+	}
+}
+
+// ==================== ASSET ====================
+
+UDiceTimelineAsset::UDiceTimelineAsset()
+{
+	Length = 0.0f;
+}
+
+void UDiceTimelineAsset::PostLoad()
+{
+	Super::PostLoad();
+	SortKeys();
+}
+
+#if WITH_EDITOR
+void UDiceTimelineAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	SortKeys();
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
+void UDiceTimelineAsset::AddFloatKey(FName Track, float Time, float Value, EDiceTimelineEase Ease)
+{
+	int32 TrackIndex = FindFloatTrack(Track);
+	if (TrackIndex == INDEX_NONE)
+	{
+		TrackIndex = FloatTracks.AddDefaulted();
+		FloatTracks[TrackIndex].Name = Track;
+	}
+
+	FDiceTimelineFloatKey& Key = FloatTracks[TrackIndex].Keys.AddDefaulted_GetRef();
+	Key.Time = Time;
+	Key.Value = Value;
+	Key.Ease = Ease;
+	SortByTime(FloatTracks[TrackIndex].Keys);
+}
+
+void UDiceTimelineAsset::AddEvent(float Time, FName Event)
+{
+	FDiceTimelineEventKey& Key = Events.AddDefaulted_GetRef();
+	Key.Time = Time;
+	Key.Event = Event;
+	SortByTime(Events);
+}
+
+void UDiceTimelineAsset::SortKeys()
+{
+	for (FDiceTimelineFloatTrack& Track : FloatTracks)
+	{
+		SortByTime(Track.Keys);
+	}
+	for (FDiceTimelineTransformTrack& Track : TransformTracks)
+	{
+		SortByTime(Track.Keys);
+	}
+	SortByTime(Events);
+}
+
+float UDiceTimelineAsset::GetDuration() const
+{
+	float Duration = Length;
+	for (const FDiceTimelineFloatTrack& Track : FloatTracks)
+	{
+		if (Track.Keys.Num() > 0)
+		{
+			Duration = FMath::Max(Duration, Track.Keys.Last().Time);
+		}
+	}
+	for (const FDiceTimelineTransformTrack& Track : TransformTracks)
+	{
+		if (Track.Keys.Num() > 0)
+		{
+			Duration = FMath::Max(Duration, Track.Keys.Last().Time);
+		}
+	}
+	if (Events.Num() > 0)
+	{
+		Duration = FMath::Max(Duration, Events.Last().Time);
+	}
+	return Duration;
+}
+
+int32 UDiceTimelineAsset::FindFloatTrack(FName Track) const
+{
+	return FloatTracks.IndexOfByPredicate([Track](const FDiceTimelineFloatTrack& Entry)
+	{
+		return Entry.Name == Track && Entry.Keys.Num() > 0;
+	});
+}
+
+int32 UDiceTimelineAsset::FindTransformTrack(FName Track) const
+{
+	return TransformTracks.IndexOfByPredicate([Track](const FDiceTimelineTransformTrack& Entry)
+	{
+		return Entry.Name == Track && Entry.Keys.Num() > 0;
+	});
+}
+
+float UDiceTimelineAsset::ApplyEase(EDiceTimelineEase Ease, float Alpha)
+{
+	switch (Ease)
+	{
+		case EDiceTimelineEase::EaseInQuad:
+			return Alpha * Alpha;
+		case EDiceTimelineEase::EaseOutQuad:
+			return 1.0f - (1.0f - Alpha) * (1.0f - Alpha);
+		case EDiceTimelineEase::EaseInCubic:
+			return Alpha * Alpha * Alpha;
+		case EDiceTimelineEase::EaseOutCubic:
+			return 1.0f - FMath::Pow(1.0f - Alpha, 3.0f);
+		case EDiceTimelineEase::EaseInOutCubic:
+			return Alpha < 0.5f
+				? 4.0f * Alpha * Alpha * Alpha
+				: 1.0f - FMath::Pow(-2.0f * Alpha + 2.0f, 3.0f) / 2.0f;
+		case EDiceTimelineEase::Step:
+			return Alpha < 1.0f ? 0.0f : 1.0f;
+		default:
+			return Alpha;
+	}
+}
+
+// ==================== PLAYER ====================
+
+void FDiceTimelinePlayer::Play(const UDiceTimelineAsset* InTimeline)
+{
+	Timeline = InTimeline;
+	Time = 0.0f;
+	EventCursor = 0;
+	Duration = Timeline ? Timeline->GetDuration() : 0.0f;
+
+	FloatCursors.Reset();
+	TransformCursors.Reset();
+	if (Timeline)
+	{
+		FloatCursors.SetNumZeroed(Timeline->FloatTracks.Num());
+		TransformCursors.SetNumZeroed(Timeline->TransformTracks.Num());
+	}
+}
+
+void FDiceTimelinePlayer::Stop()
+{
+	Timeline = nullptr;
+	Time = 0.0f;
+	Duration = 0.0f;
+	EventCursor = 0;
+}
+
+void FDiceTimelinePlayer::Advance(float DeltaTime, TFunctionRef<void(FName)> OnEvent)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DiceTimelineAdvance);
+
+	if (!Timeline)
+	{
+		return;
+	}
+
+	Time += FMath::Max(0.0f, DeltaTime);
+
+	const UDiceTimelineAsset* Playing = Timeline;
+	while (EventCursor < Playing->Events.Num() && Playing->Events[EventCursor].Time <= Time)
+	{
+		const FName Event = Playing->Events[EventCursor].Event;
+		EventCursor++;
+		OnEvent(Event);
+
+		// The handler is free to stop or restart playback
+		if (Timeline != Playing)
+		{
+			break;
+		}
+	}
+}
+
+bool FDiceTimelinePlayer::HasFloat(FName Track) const
+{
+	return Timeline && Timeline->FindFloatTrack(Track) != INDEX_NONE;
+}
+
+bool FDiceTimelinePlayer::HasTransform(FName Track) const
+{
+	return Timeline && Timeline->FindTransformTrack(Track) != INDEX_NONE;
+}
+
+float FDiceTimelinePlayer::EvaluateFloat(FName Track, float Default)
+{
+	const int32 TrackIndex = Timeline ? Timeline->FindFloatTrack(Track) : INDEX_NONE;
+	if (TrackIndex == INDEX_NONE)
+	{
+		return Default;
+	}
+
+	const TArray<FDiceTimelineFloatKey>& Keys = Timeline->FloatTracks[TrackIndex].Keys;
+	if (!FloatCursors.IsValidIndex(TrackIndex))
+	{
+		FloatCursors.SetNumZeroed(Timeline->FloatTracks.Num());  // Tracks added while playing in the editor
+	}
+	int32& Cursor = FloatCursors[TrackIndex];
+	Cursor = SeekCursor(Keys, Cursor, Time);
+	return SampleFloat(Keys, Cursor, Time);
+}
+
+bool FDiceTimelinePlayer::EvaluateTransform(FName Track, FVector& OutLocation, FRotator& OutRotation, FVector& OutScale)
+{
+	const int32 TrackIndex = Timeline ? Timeline->FindTransformTrack(Track) : INDEX_NONE;
+	if (TrackIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const TArray<FDiceTimelineTransformKey>& Keys = Timeline->TransformTracks[TrackIndex].Keys;
+	if (!TransformCursors.IsValidIndex(TrackIndex))
+	{
+		TransformCursors.SetNumZeroed(Timeline->TransformTracks.Num());
+	}
+	int32& Cursor = TransformCursors[TrackIndex];
+	Cursor = SeekCursor(Keys, Cursor, Time);
+
+	const FDiceTimelineTransformKey& From = Keys[Cursor];
+	if (Cursor + 1 >= Keys.Num())
+	{
+		OutLocation = From.Location;
+		OutRotation = From.Rotation;
+		OutScale = From.Scale;
+		return true;
+	}
+
+	const FDiceTimelineTransformKey& To = Keys[Cursor + 1];
+	const float Alpha = SegmentAlpha(Keys, Cursor, Time);
+	OutLocation = FMath::Lerp(From.Location, To.Location, Alpha);
+	OutRotation = From.Rotation + (To.Rotation - From.Rotation) * Alpha;  // Not FMath::Lerp - that takes the short way
+	OutScale = FMath::Lerp(From.Scale, To.Scale, Alpha);
+	return true;
+}
+
+float FDiceTimelinePlayer::EvaluateFloatAt(FName Track, float AtTime, float Default) const
+{
+	const int32 TrackIndex = Timeline ? Timeline->FindFloatTrack(Track) : INDEX_NONE;
+	if (TrackIndex == INDEX_NONE)
+	{
+		return Default;
+	}
+
+	const TArray<FDiceTimelineFloatKey>& Keys = Timeline->FloatTracks[TrackIndex].Keys;
+	return SampleFloat(Keys, FindCursor(Keys, AtTime), AtTime);
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "DiceTimeline.generated.h"
+
+// Easing of the segment that ends at a key
+UENUM(BlueprintType)
+enum class EDiceTimelineEase : uint8
+{
+	Linear,
+	EaseInQuad,
+	EaseOutQuad,
+	EaseInCubic,
+	EaseOutCubic,
+	EaseInOutCubic,
+	Step  // Holds the previous key until this one is reached
+};
+
+USTRUCT(BlueprintType)
+struct FDiceTimelineFloatKey
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	float Time = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	float Value = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	EDiceTimelineEase Ease = EDiceTimelineEase::Linear;
+};
+
+USTRUCT(BlueprintType)
+struct FDiceTimelineTransformKey
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	float Time = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	FVector Location = FVector::ZeroVector;
+
+	// Lerped per component, so a yaw of 90 -> 270 turns the long way round as keyed
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	FVector Scale = FVector::OneVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	EDiceTimelineEase Ease = EDiceTimelineEase::Linear;
+};
+
+USTRUCT(BlueprintType)
+struct FDiceTimelineEventKey
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	float Time = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	FName Event;
+};
+
+// Keys must be sorted by time - UDiceTimelineAsset sorts them on load and in the editor
+USTRUCT(BlueprintType)
+struct FDiceTimelineFloatTrack
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	TArray<FDiceTimelineFloatKey> Keys;
+};
+
+USTRUCT(BlueprintType)
+struct FDiceTimelineTransformTrack
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	TArray<FDiceTimelineTransformKey> Keys;
+};
+
+// Keyed sequence of float, transform and event tracks.
+// The game looks tracks up by name, so a sequence can be retimed (or have tracks added) without touching code.
+// A track the timeline leaves out reads as its neutral value; code-built defaults cover unassigned sequences.
+UCLASS(BlueprintType)
+class UDiceTimelineAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UDiceTimelineAsset();
+
+	// Minimum length in seconds - the timeline also runs until its last key
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	float Length;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	TArray<FDiceTimelineFloatTrack> FloatTracks;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	TArray<FDiceTimelineTransformTrack> TransformTracks;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Timeline")
+	TArray<FDiceTimelineEventKey> Events;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// ===== BUILDING (for timelines made in code) =====
+	void AddFloatKey(FName Track, float Time, float Value, EDiceTimelineEase Ease = EDiceTimelineEase::Linear);
+	void AddEvent(float Time, FName Event);
+	void SortKeys();
+
+	float GetDuration() const;
+	int32 FindFloatTrack(FName Track) const;
+	int32 FindTransformTrack(FName Track) const;
+
+	static float ApplyEase(EDiceTimelineEase Ease, float Alpha);
+};
+
+// Plays one timeline. Keeps a cursor per track so sampling the playhead is O(1) amortized -
+// the cost of a frame is the number of tracks actually sampled.
+// The asset is not owned; whoever starts playback keeps it referenced.
+struct FDiceTimelinePlayer
+{
+	void Play(const UDiceTimelineAsset* InTimeline);
+	void Stop();
+
+	// Move the playhead forward and fire every event it crosses, in order
+	void Advance(float DeltaTime, TFunctionRef<void(FName)> OnEvent);
+
+	bool IsPlaying() const { return Timeline != nullptr; }
+	bool IsFinished() const { return Timeline && Time >= Duration; }
+	float GetTime() const { return Time; }
+	float GetDuration() const { return Duration; }
+
+	bool HasFloat(FName Track) const;
+	bool HasTransform(FName Track) const;
+
+	// Sample at the playhead - Default if the timeline has no such track
+	float EvaluateFloat(FName Track, float Default = 0.0f);
+	bool EvaluateTransform(FName Track, FVector& OutLocation, FRotator& OutRotation, FVector& OutScale);
+
+	// Random access (binary search) for staggered reads of one track at several times
+	float EvaluateFloatAt(FName Track, float AtTime, float Default = 0.0f) const;
+
+private:
+	const UDiceTimelineAsset* Timeline = nullptr;
+	float Time = 0.0f;
+	float Duration = 0.0f;
+	int32 EventCursor = 0;
+	TArray<int32> FloatCursors;
+	TArray<int32> TransformCursors;
+};
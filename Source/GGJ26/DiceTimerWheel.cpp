@@ -0,0 +1,309 @@
+#include "DiceTimerWheel.h"
+#include "Engine/World.h"
+
+UDiceTimerWheel::UDiceTimerWheel()
+{
+	for (int32 i = 0; i < NumLevels * SlotsPerLevel; i++)
+	{
+		Buckets[i] = INDEX_NONE;
+	}
+
+	CurrentTick = 0;
+	TickAccumulator = 0.0f;
+	NumActive = 0;
+	bPaused = false;
+	TimeScale = 1.0f;
+}
+
+void UDiceTimerWheel::Deinitialize()
+{
+	// Drop every pending callback - nothing should fire into a torn down world
+	Nodes.Empty();
+	FreeNodes.Empty();
+	for (int32 i = 0; i < NumLevels * SlotsPerLevel; i++)
+	{
+		Buckets[i] = INDEX_NONE;
+	}
+	NumActive = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UDiceTimerWheel::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDiceTimerWheel, STATGROUP_Tickables);
+}
+
+UDiceTimerWheel* UDiceTimerWheel::Get(const UObject* WorldContext)
+{
+	UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDiceTimerWheel>() : nullptr;
+}
+
+// ==================== SCHEDULING ====================
+
+FDiceTimerHandle UDiceTimerWheel::Schedule(UObject* Owner, float Delay, TFunction<void()>&& Callback, float RepeatInterval)
+{
+	FDiceTimerHandle Handle;
+	if (!Callback)
+	{
+		return Handle;
+	}
+
+	int32 NodeIndex;
+	if (FreeNodes.Num() > 0)
+	{
+		NodeIndex = FreeNodes.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		NodeIndex = Nodes.AddDefaulted();
+		Nodes[NodeIndex].Serial = 1;
+	}
+
+	FTimerNode& Node = Nodes[NodeIndex];
+	Node.Callback = MoveTemp(Callback);
+	Node.Owner = Owner;
+	Node.bHasOwner = (Owner != nullptr);
+	Node.RepeatInterval = FMath::Max(0.0f, RepeatInterval);
+	Node.ExpireTick = DelayToExpireTick(Delay);
+	Node.bActive = true;
+	NumActive++;
+
+	Insert(NodeIndex);
+
+	Handle.Index = NodeIndex;
+	Handle.Serial = Node.Serial;
+	return Handle;
+}
+
+void UDiceTimerWheel::Cancel(FDiceTimerHandle& Handle)
+{
+	if (IsHandleLive(Handle))
+	{
+		if (Nodes[Handle.Index].Bucket != INDEX_NONE)
+		{
+			Unlink(Handle.Index);
+		}
+		Release(Handle.Index);
+	}
+	Handle.Invalidate();
+}
+
+bool UDiceTimerWheel::IsActive(const FDiceTimerHandle& Handle) const
+{
+	return IsHandleLive(Handle);
+}
+
+float UDiceTimerWheel::GetRemaining(const FDiceTimerHandle& Handle) const
+{
+	if (!IsHandleLive(Handle))
+	{
+		return 0.0f;
+	}
+
+	const uint64 TicksLeft = Nodes[Handle.Index].ExpireTick - CurrentTick + 1;
+	return FMath::Max(0.0f, TicksLeft * TickResolution - TickAccumulator);
+}
+
+bool UDiceTimerWheel::IsHandleLive(const FDiceTimerHandle& Handle) const
+{
+	return Nodes.IsValidIndex(Handle.Index)
+		&& Nodes[Handle.Index].bActive
+		&& Nodes[Handle.Index].Serial == Handle.Serial;
+}
+
+uint64 UDiceTimerWheel::DelayToExpireTick(float Delay) const
+{
+	// Tick N is processed once (N + 1) * TickResolution seconds have accumulated
+	const int64 Ticks = FMath::CeilToInt64((TickAccumulator + FMath::Max(0.0f, Delay)) / TickResolution) - 1;
+	const int64 MaxTicks = (int64(1) << (NumLevels * SlotBits)) - 1;
+	return CurrentTick + FMath::Clamp<int64>(Ticks, 0, MaxTicks);
+}
+
+// ==================== WHEEL ====================
+
+void UDiceTimerWheel::Insert(int32 NodeIndex)
+{
+	FTimerNode& Node = Nodes[NodeIndex];
+
+	// Anything already due goes into the slot processed next
+	const uint64 Expire = FMath::Max(Node.ExpireTick, CurrentTick);
+	const uint64 Delta = Expire - CurrentTick;
+
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && Delta >= (uint64(1) << ((Level + 1) * SlotBits)))
+	{
+		Level++;
+	}
+
+	const int32 Slot = int32((Expire >> (Level * SlotBits)) & SlotMask);
+	const int32 Bucket = Level * SlotsPerLevel + Slot;
+
+	Node.Bucket = Bucket;
+	Node.Prev = INDEX_NONE;
+	Node.Next = Buckets[Bucket];
+	if (Node.Next != INDEX_NONE)
+	{
+		Nodes[Node.Next].Prev = NodeIndex;
+	}
+	Buckets[Bucket] = NodeIndex;
+}
+
+void UDiceTimerWheel::Unlink(int32 NodeIndex)
+{
+	FTimerNode& Node = Nodes[NodeIndex];
+
+	if (Node.Prev != INDEX_NONE)
+	{
+		Nodes[Node.Prev].Next = Node.Next;
+	}
+	else
+	{
+		Buckets[Node.Bucket] = Node.Next;
+	}
+
+	if (Node.Next != INDEX_NONE)
+	{
+		Nodes[Node.Next].Prev = Node.Prev;
+	}
+
+	Node.Prev = INDEX_NONE;
+	Node.Next = INDEX_NONE;
+	Node.Bucket = INDEX_NONE;
+}
+
+void UDiceTimerWheel::Release(int32 NodeIndex)
+{
+	FTimerNode& Node = Nodes[NodeIndex];
+	Node.Callback.Reset();
+	Node.Owner.Reset();
+	Node.bHasOwner = false;
+	Node.bActive = false;
+	Node.Bucket = INDEX_NONE;
+	Node.Serial++;
+
+	FreeNodes.Push(NodeIndex);
+	NumActive--;
+}
+
+int32 UDiceTimerWheel::Cascade(int32 Level)
+{
+	// Pull down every timer in this level's current slot - they are now close enough for a lower level
+	const int32 Slot = int32((CurrentTick >> (Level * SlotBits)) & SlotMask);
+	const int32 Bucket = Level * SlotsPerLevel + Slot;
+
+	int32 NodeIndex = Buckets[Bucket];
+	Buckets[Bucket] = INDEX_NONE;
+
+	while (NodeIndex != INDEX_NONE)
+	{
+		const int32 NextIndex = Nodes[NodeIndex].Next;
+		Insert(NodeIndex);
+		NodeIndex = NextIndex;
+	}
+
+	return Slot;
+}
+
+void UDiceTimerWheel::ProcessTick()
+{
+	const int32 Slot = int32(CurrentTick & SlotMask);
+	if (Slot == 0)
+	{
+		for (int32 Level = 1; Level < NumLevels; Level++)
+		{
+			if (Cascade(Level) != 0)
+			{
+				break;
+			}
+		}
+	}
+
+	// Detach the due list first - callbacks are free to schedule and cancel
+	TArray<TPair<int32, uint32>, TInlineAllocator<16>> Due;
+	int32 NodeIndex = Buckets[Slot];
+	Buckets[Slot] = INDEX_NONE;
+	while (NodeIndex != INDEX_NONE)
+	{
+		FTimerNode& Node = Nodes[NodeIndex];
+		Due.Emplace(NodeIndex, Node.Serial);
+		const int32 NextIndex = Node.Next;
+		Node.Prev = INDEX_NONE;
+		Node.Next = INDEX_NONE;
+		Node.Bucket = INDEX_NONE;
+		NodeIndex = NextIndex;
+	}
+
+	const uint64 FiredTick = CurrentTick;
+	CurrentTick++;
+
+	for (const TPair<int32, uint32>& Entry : Due)
+	{
+		FTimerNode& Node = Nodes[Entry.Key];
+		if (!Node.bActive || Node.Serial != Entry.Value)
+		{
+			continue;  // Cancelled by an earlier callback this tick
+		}
+
+		if (Node.bHasOwner && !Node.Owner.IsValid())
+		{
+			Release(Entry.Key);
+			continue;
+		}
+
+		// Move the callback out - Nodes may grow while it runs
+		TFunction<void()> Callback = MoveTemp(Node.Callback);
+
+		if (Node.RepeatInterval > 0.0f)
+		{
+			const int64 IntervalTicks = FMath::Max<int64>(1, FMath::CeilToInt64(Node.RepeatInterval / TickResolution));
+			Node.ExpireTick = FiredTick + IntervalTicks;
+			Insert(Entry.Key);
+		}
+		else
+		{
+			Release(Entry.Key);
+		}
+
+		Callback();
+
+		// Hand a repeating callback back unless it cancelled itself
+		if (Nodes[Entry.Key].bActive && Nodes[Entry.Key].Serial == Entry.Value)
+		{
+			Nodes[Entry.Key].Callback = MoveTemp(Callback);
+		}
+	}
+}
+
+void UDiceTimerWheel::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bPaused)
+	{
+		return;
+	}
+
+	TickAccumulator += DeltaTime * TimeScale;
+
+	while (TickAccumulator >= TickResolution)
+	{
+		if (NumActive == 0)
+		{
+			// Nothing armed - just keep the clock in step
+			const int64 SkipTicks = FMath::FloorToInt64(TickAccumulator / TickResolution);
+			CurrentTick += SkipTicks;
+			TickAccumulator -= SkipTicks * TickResolution;
+			break;
+		}
+
+		TickAccumulator -= TickResolution;
+		ProcessTick();
+
+		if (bPaused)
+		{
+			break;  // A callback paused the wheel
+		}
+	}
+}
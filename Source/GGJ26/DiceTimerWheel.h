@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DiceTimerWheel.generated.h"
+
+// Handle to a scheduled callback. Stale handles are safe to cancel/query.
+struct FDiceTimerHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+};
+
+// Hierarchical timer wheel for gameplay waits.
+// Schedule and cancel are O(1); only armed timers cost anything per frame.
+// Ticks with the world (so it stops when the game is paused) and can be paused/time-scaled on its own.
+UCLASS()
+class UDiceTimerWheel : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UDiceTimerWheel();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static UDiceTimerWheel* Get(const UObject* WorldContext);
+
+	// Fire Callback after Delay seconds (RepeatInterval > 0 keeps it firing).
+	// If Owner is set the callback is dropped once Owner is destroyed.
+	FDiceTimerHandle Schedule(UObject* Owner, float Delay, TFunction<void()>&& Callback, float RepeatInterval = 0.0f);
+
+	// Cancel and invalidate the handle. Safe to call on stale or already-fired handles.
+	void Cancel(FDiceTimerHandle& Handle);
+
+	bool IsActive(const FDiceTimerHandle& Handle) const;
+	float GetRemaining(const FDiceTimerHandle& Handle) const;
+
+	// ===== PAUSE / TIME SCALE =====
+	void SetPaused(bool bInPaused) { bPaused = bInPaused; }
+	bool IsPaused() const { return bPaused; }
+
+	void SetTimeScale(float InTimeScale) { TimeScale = FMath::Max(0.0f, InTimeScale); }
+	float GetTimeScale() const { return TimeScale; }
+
+	int32 GetNumActiveTimers() const { return NumActive; }
+
+private:
+	// 4 levels x 64 slots at 120 ticks/sec covers ~38 hours
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+	static constexpr int32 SlotMask = SlotsPerLevel - 1;
+	static constexpr int32 NumLevels = 4;
+	static constexpr float TickResolution = 1.0f / 120.0f;
+
+	struct FTimerNode
+	{
+		TFunction<void()> Callback;
+		TWeakObjectPtr<UObject> Owner;
+		bool bHasOwner = false;
+		uint64 ExpireTick = 0;
+		float RepeatInterval = 0.0f;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 Bucket = INDEX_NONE;  // INDEX_NONE = free or about to fire
+		uint32 Serial = 0;
+		bool bActive = false;
+	};
+
+	TArray<FTimerNode> Nodes;
+	TArray<int32> FreeNodes;
+	int32 Buckets[NumLevels * SlotsPerLevel];
+
+	uint64 CurrentTick;      // Next tick to be processed
+	float TickAccumulator;   // Scaled seconds not yet turned into ticks
+	int32 NumActive;
+
+	bool bPaused;
+	float TimeScale;
+
+	uint64 DelayToExpireTick(float Delay) const;
+	void Insert(int32 NodeIndex);
+	void Unlink(int32 NodeIndex);
+	void Release(int32 NodeIndex);
+	int32 Cascade(int32 Level);
+	void ProcessTick();
+	bool IsHandleLive(const FDiceTimerHandle& Handle) const;
+};
@@ -3,5 +3,6 @@
 #include "GGJ26.h"
 #include "Modules/ModuleManager.h"
 
+DEFINE_LOG_CATEGORY(LogDiceGame);
+
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, GGJ26, "GGJ26" );
- 
\ No newline at end of file
@@ -3,3 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogDiceGame, Log, All);
+
+// 'stat DiceGame' - counters for the game's own hot paths
+DECLARE_STATS_GROUP(TEXT("DiceGame"), STATGROUP_DiceGame, STATCAT_Advanced);
+
+// Debug drawing, tuning tools and cheat keys only exist outside Shipping/Test builds
+#define DICE_DEBUG_DRAW (!(UE_BUILD_SHIPPING || UE_BUILD_TEST))
@@ -2,6 +2,7 @@
 
 #include "GameModeDice.h"
 #include "DicePlayer.h"
+#include "DiceEventBus.h"
 
 AGameModeDice::AGameModeDice()
 {
@@ -12,6 +13,8 @@ AGameModeDice::AGameModeDice()
 	MaxRounds = 10;
 	LastRollResult = 0;
 	MainCamera = nullptr;
+
+	PoolRandom.GenerateNewSeed();
 }
 
 void AGameModeDice::BeginPlay()
@@ -27,33 +30,49 @@ int32 AGameModeDice::RollDice(int32 Sides)
 	}
 
 	LastRollResult = FMath::RandRange(1, Sides);
+	UDiceEventBus::Broadcast(this, FDiceRolledEvent{ LastRollResult });
 	OnDiceRolled.Broadcast(LastRollResult);
 
 	return LastRollResult;
 }
 
-int32 AGameModeDice::RollMultipleDice(int32 NumDice, int32 Sides)
+int32 AGameModeDice::RollMultipleDice(int32 NumDice, int32 Sides, bool bApproximate)
 {
-	int32 Total = 0;
-
-	for (int32 i = 0; i < NumDice; i++)
+	if (NumDice <= 0)
+	{
+		return 0;
+	}
+	if (NumDice == 1)
 	{
-		Total += RollDice(Sides);
+		return RollDice(Sides);
+	}
+	if (Sides < 2)
+	{
+		Sides = 2;
 	}
 
-	return Total;
+	// One draw for the whole pool instead of NumDice rolls
+	LastRollResult = bApproximate
+		? FDiceSumDistribution::SampleNormal(NumDice, Sides, PoolRandom)
+		: FDiceSumDistribution::SampleExact(NumDice, Sides, PoolRandom);
+	UDiceEventBus::Broadcast(this, FDiceRolledEvent{ LastRollResult });
+	OnDiceRolled.Broadcast(LastRollResult);
+
+	return LastRollResult;
 }
 
 void AGameModeDice::StartGame()
 {
 	bGameInProgress = true;
 	CurrentRound = 1;
+	UDiceEventBus::Broadcast(this, FDiceGameStartedEvent{});
 	OnGameStarted.Broadcast();
 }
 
 void AGameModeDice::EndGame(bool bWon)
 {
 	bGameInProgress = false;
+	UDiceEventBus::Broadcast(this, FDiceGameEndedEvent{ bWon });
 	OnGameEnded.Broadcast(bWon);
 }
 
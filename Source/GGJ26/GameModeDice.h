@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "DiceCamera.h"
+#include "DiceSumDistribution.h"
 #include "GameModeDice.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDiceRolled, int32, Result);
@@ -25,9 +26,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Dice")
 	int32 RollDice(int32 Sides = 6);
 
-	// Roll multiple dice and return the sum
+	// Roll multiple dice and return the sum (broadcasts OnDiceRolled once, with the total).
+	// Exact and O(log N) per roll from a cached distribution; bApproximate opts into a normal approximation instead.
 	UFUNCTION(BlueprintCallable, Category = "Dice")
-	int32 RollMultipleDice(int32 NumDice, int32 Sides = 6);
+	int32 RollMultipleDice(int32 NumDice, int32 Sides = 6, bool bApproximate = false);
 
 	// Start the game
 	UFUNCTION(BlueprintCallable, Category = "Game")
@@ -70,4 +72,8 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Camera")
 	void SetMainCamera(ADiceCamera* Camera);
+
+private:
+	// Pool rolls need 53-bit uniforms - neither FMath::Rand nor a 32-bit FRandomStream can give them
+	FDiceRandom64 PoolRandom;
 };
@@ -1,6 +1,12 @@
 #include "HangingBoardComponent.h"
 #include "Components/TextRenderComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "DiceTimerWheel.h"
+#include "DiceEventBus.h"
+#include "DiceGameManager.h"
+#include "DiceSignificance.h"
+#include "DiceTextRevealComponent.h"
+#include "DiceLabelBatcher.h"
 
 UHangingBoardComponent::UHangingBoardComponent()
 {
@@ -27,10 +33,7 @@ UHangingBoardComponent::UHangingBoardComponent()
 
 	ContentLabel = nullptr;
 	BoardMesh = nullptr;
-	RevealedChars = 0;
-	TextRevealTimer = 0.0f;
-	bTextRevealing = false;
-	ButtonDelayTimer = 0.0f;
+	TextReveal = nullptr;
 	bWaitingForButtonDelay = false;
 }
 
@@ -71,9 +74,14 @@ void UHangingBoardComponent::BeginPlay()
 		}
 
 		// Clear text initially
-		if (ContentLabel)
+		UDiceLabelBatcher::Adopt(ContentLabel);
+		TextReveal = UDiceTextRevealComponent::FindOrCreate(Owner, ContentLabel);
+		if (TextReveal)
 		{
-			ContentLabel->SetText(FText::FromString(TEXT("")));
+			TextReveal->Mode = ETextRevealMode::Scramble;
+			TextReveal->CharsPerSecond = TextRevealSpeed;
+			TextReveal->ScrambleChars = TEXT("#@$%&*?!");
+			TextReveal->Clear();
 			ContentLabel->SetVisibility(false);
 		}
 	}
@@ -84,6 +92,19 @@ void UHangingBoardComponent::BeginPlay()
 	{
 		Owner->SetActorLocation(HiddenPosition);
 	}
+
+	// Descent/ascent gate the flow - only the idle shimmer is cosmetic
+	if (UDiceSignificanceManager* Significance = UDiceSignificanceManager::Get(this))
+	{
+		Significance->Register(this, PrimaryComponentTick, BoardMesh, [this](EGamePhase)
+		{
+			if (CurrentState == EBoardState::Descending || CurrentState == EBoardState::Ascending)
+			{
+				return EDiceSignificance::Critical;
+			}
+			return CurrentState == EBoardState::Visible ? EDiceSignificance::Medium : EDiceSignificance::Dormant;
+		});
+	}
 }
 
 void UHangingBoardComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -107,23 +128,6 @@ void UHangingBoardComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		default:
 			break;
 	}
-
-	// Update text reveal
-	if (bTextRevealing)
-	{
-		UpdateTextReveal(DeltaTime);
-	}
-
-	// Handle delay before activating button
-	if (bWaitingForButtonDelay)
-	{
-		ButtonDelayTimer += DeltaTime;
-		if (ButtonDelayTimer >= DelayBeforeButton)
-		{
-			bWaitingForButtonDelay = false;
-			OnBoardArrived.Broadcast();
-		}
-	}
 }
 
 void UHangingBoardComponent::ShowBoard(const FString& Text)
@@ -155,14 +159,17 @@ void UHangingBoardComponent::ShowBoard(const FString& Text)
 	CurrentState = EBoardState::Descending;
 
 	// Clear text, will reveal after board arrives
-	if (ContentLabel)
+	if (TextReveal)
 	{
-		ContentLabel->SetText(FText::FromString(TEXT("")));
+		TextReveal->Clear();
 	}
-	bTextRevealing = false;
-	RevealedChars = 0;
 	bWaitingForButtonDelay = false;
-	ButtonDelayTimer = 0.0f;
+	if (UDiceTimerWheel* Wheel = UDiceTimerWheel::Get(this))
+	{
+		Wheel->Cancel(ButtonDelayHandle);
+	}
+
+	UDiceSignificanceManager::RefreshFor(this);
 }
 
 void UHangingBoardComponent::HideBoard()
@@ -173,19 +180,20 @@ void UHangingBoardComponent::HideBoard()
 	StartPosition = Owner->GetActorLocation();
 	AnimProgress = 0.0f;
 	CurrentState = EBoardState::Ascending;
-	bTextRevealing = false;
+	if (TextReveal)
+	{
+		TextReveal->Stop();
+	}
+
+	UDiceSignificanceManager::RefreshFor(this);
 }
 
 void UHangingBoardComponent::SetBoardText(const FString& Text)
 {
 	BoardText = Text;
-	if (ContentLabel && CurrentState == EBoardState::Visible)
+	if (TextReveal && CurrentState == EBoardState::Visible)
 	{
-		// Start text reveal
-		FullText = Text;
-		RevealedChars = 0;
-		TextRevealTimer = 0.0f;
-		bTextRevealing = true;
+		TextReveal->RevealIn(Text);
 	}
 }
 
@@ -204,14 +212,25 @@ void UHangingBoardComponent::UpdateDescend(float DeltaTime)
 		ShimmerTimer = 0.0f;
 
 		// Start text reveal
-		FullText = BoardText;
-		RevealedChars = 0;
-		TextRevealTimer = 0.0f;
-		bTextRevealing = true;
+		if (TextReveal)
+		{
+			TextReveal->CharsPerSecond = TextRevealSpeed;
+			TextReveal->RevealIn(BoardText);
+		}
 
 		// Start delay before button activation (gives time to read)
 		bWaitingForButtonDelay = true;
-		ButtonDelayTimer = 0.0f;
+		if (UDiceTimerWheel* Wheel = UDiceTimerWheel::Get(this))
+		{
+			ButtonDelayHandle = Wheel->Schedule(this, DelayBeforeButton, [this]()
+			{
+				bWaitingForButtonDelay = false;
+				UDiceEventBus::Broadcast(this, FDiceBoardArrivedEvent{ this });
+				OnBoardArrived.Broadcast();
+			});
+		}
+
+		UDiceSignificanceManager::RefreshFor(this);
 	}
 	else
 	{
@@ -260,6 +279,9 @@ void UHangingBoardComponent::UpdateAscend(float DeltaTime)
 			ContentLabel->SetVisibility(false);
 		}
 
+		UDiceSignificanceManager::RefreshFor(this);
+
+		UDiceEventBus::Broadcast(this, FDiceBoardRetractedEvent{ this });
 		OnBoardRetracted.Broadcast();
 	}
 	else
@@ -293,46 +315,6 @@ void UHangingBoardComponent::UpdateShimmer(float DeltaTime)
 	Owner->SetActorRotation(CurrentRot);
 }
 
-void UHangingBoardComponent::UpdateTextReveal(float DeltaTime)
-{
-	if (!ContentLabel) return;
-
-	TextRevealTimer += DeltaTime * TextRevealSpeed;
-	int32 NewCharCount = FMath::FloorToInt(TextRevealTimer);
-
-	if (NewCharCount > RevealedChars)
-	{
-		RevealedChars = NewCharCount;
-
-		if (RevealedChars >= FullText.Len())
-		{
-			// Fully revealed
-			ContentLabel->SetText(FText::FromString(FullText));
-			bTextRevealing = false;
-		}
-		else
-		{
-			// Partial reveal with scrambled remaining chars
-			FString DisplayText;
-			TArray<TCHAR> ScrambleChars = { '#', '@', '$', '%', '&', '*', '?', '!' };
-
-			for (int32 i = 0; i < FullText.Len(); i++)
-			{
-				if (i < RevealedChars)
-				{
-					DisplayText.AppendChar(FullText[i]);
-				}
-				else
-				{
-					int32 RandIdx = FMath::RandRange(0, ScrambleChars.Num() - 1);
-					DisplayText.AppendChar(ScrambleChars[RandIdx]);
-				}
-			}
-			ContentLabel->SetText(FText::FromString(DisplayText));
-		}
-	}
-}
-
 float UHangingBoardComponent::EaseOutBounce(float t)
 {
 	if (t < 1.0f / 2.75f)
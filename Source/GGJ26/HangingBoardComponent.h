@@ -2,10 +2,12 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "DiceTimerWheel.h"
 #include "HangingBoardComponent.generated.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
+class UDiceTextRevealComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBoardArrived);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnBoardRetracted);
@@ -92,19 +94,15 @@ private:
 	float ShimmerTimer;
 
 	// Text reveal
-	FString FullText;
-	int32 RevealedChars;
-	float TextRevealTimer;
-	bool bTextRevealing;
+	UDiceTextRevealComponent* TextReveal;
 
 	// Delay before button
-	float ButtonDelayTimer;
+	FDiceTimerHandle ButtonDelayHandle;
 	bool bWaitingForButtonDelay;
 
 	void UpdateDescend(float DeltaTime);
 	void UpdateAscend(float DeltaTime);
 	void UpdateShimmer(float DeltaTime);
-	void UpdateTextReveal(float DeltaTime);
 
 	float EaseOutBounce(float t);
 	float EaseInBack(float t);
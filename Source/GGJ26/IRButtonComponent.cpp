@@ -1,13 +1,15 @@
 #include "IRButtonComponent.h"
+#include "GGJ26.h"
 #include "DiceCamera.h"
+#include "DiceEventBus.h"
+#include "DiceLabelBatcher.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/TextRenderComponent.h"
-#include "Kismet/GameplayStatics.h"
-#include "GameFramework/PlayerController.h"
 
 UIRButtonComponent::UIRButtonComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;  // Only ticks while the switch or camera is moving
 
 	// Default to Yes button
 	ButtonType = EIRButtonType::Yes;
@@ -29,7 +31,6 @@ UIRButtonComponent::UIRButtonComponent()
 	bButtonActive = false;
 	bIsPressed = false;
 	bAnimating = false;
-	bWasMouseDown = false;
 
 	SwitchMesh = nullptr;
 	BaseMesh = nullptr;
@@ -81,12 +82,18 @@ void UIRButtonComponent::BeginPlay()
 		Label = Texts[0];
 	}
 
+	// Drawn through the shared label mesh
+	UDiceLabelBatcher::Adopt(Label);
+
 	// Store initial switch position
 	if (SwitchMesh)
 	{
 		SwitchUnpressedPos = SwitchMesh->GetRelativeLocation();
 		SwitchPressedPos = SwitchUnpressedPos;
 		SwitchPressedPos.Z -= PressDepth;  // Move down
+
+		// The player controller does the one cursor trace per click and routes it to whatever it hit
+		SwitchMesh->OnClicked.AddDynamic(this, &UIRButtonComponent::HandleSwitchClicked);
 	}
 
 	// Set label text based on button type
@@ -107,26 +114,27 @@ void UIRButtonComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 	if (bAnimating)
 	{
 		UpdateAnimation(DeltaTime);
-		return;
 	}
 
-	// Handle click input when active and not already pressed
-	if (bButtonActive && !bIsPressed)
+	RefreshTickEnabled();
+}
+
+void UIRButtonComponent::RefreshTickEnabled()
+{
+	const bool bNeedsTick = bAnimating || bCameraFocusing || bCameraReturning;
+	if (IsComponentTickEnabled() != bNeedsTick)
 	{
-		APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-		if (PC)
-		{
-			bool bMouseDown = PC->IsInputKeyDown(EKeys::LeftMouseButton);
+		SetComponentTickEnabled(bNeedsTick);
+	}
+}
 
-			// Click detection (bWasMouseDown is now a member variable, not shared between instances)
-			if (bMouseDown && !bWasMouseDown && IsMouseOverSwitch())
-			{
-				OnClicked();
-			}
+void UIRButtonComponent::HandleSwitchClicked(UPrimitiveComponent* TouchedComponent, FKey ButtonPressed)
+{
+	// Same gate the old per-tick poll used: active, not pressed yet, not mid-animation
+	if (ButtonPressed != EKeys::LeftMouseButton) return;
+	if (!bButtonActive || bIsPressed || bAnimating) return;
 
-			bWasMouseDown = bMouseDown;
-		}
-	}
+	OnClicked();
 }
 
 void UIRButtonComponent::ActivateButton()
@@ -146,11 +154,11 @@ void UIRButtonComponent::ActivateButton()
 	{
 		if (ButtonType == EIRButtonType::Yes)
 		{
-			Label->SetTextRenderColor(FColor(100, 255, 100, 255));  // Green
+			UDiceLabelBatcher::SetColor(Label, FColor(100, 255, 100, 255));  // Green
 		}
 		else
 		{
-			Label->SetTextRenderColor(FColor(255, 100, 100, 255));  // Red
+			UDiceLabelBatcher::SetColor(Label, FColor(255, 100, 100, 255));  // Red
 		}
 	}
 
@@ -159,6 +167,8 @@ void UIRButtonComponent::ActivateButton()
 	{
 		StartCameraFocus();
 	}
+
+	RefreshTickEnabled();
 }
 
 void UIRButtonComponent::DeactivateButton()
@@ -168,7 +178,7 @@ void UIRButtonComponent::DeactivateButton()
 	// Dim the label
 	if (Label)
 	{
-		Label->SetTextRenderColor(FColor(128, 128, 128, 255));  // Gray
+		UDiceLabelBatcher::SetColor(Label, FColor(128, 128, 128, 255));  // Gray
 	}
 
 	// Return camera (only if this button controls camera)
@@ -176,6 +186,8 @@ void UIRButtonComponent::DeactivateButton()
 	{
 		StartCameraReturn();
 	}
+
+	RefreshTickEnabled();
 }
 
 void UIRButtonComponent::ResetButton()
@@ -184,6 +196,8 @@ void UIRButtonComponent::ResetButton()
 	bAnimating = true;
 	SwitchStartPos = SwitchMesh ? SwitchMesh->GetRelativeLocation() : FVector::ZeroVector;
 	AnimProgress = 0.0f;
+
+	RefreshTickEnabled();
 }
 
 void UIRButtonComponent::OnClicked()
@@ -194,8 +208,9 @@ void UIRButtonComponent::OnClicked()
 	bAnimating = true;
 	SwitchStartPos = SwitchMesh ? SwitchMesh->GetRelativeLocation() : SwitchUnpressedPos;
 	AnimProgress = 0.0f;
+	RefreshTickEnabled();
 
-	UE_LOG(LogTemp, Warning, TEXT("Button Clicked: %s"), ButtonType == EIRButtonType::Yes ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogDiceGame, Log, TEXT("Button Clicked: %s"), ButtonType == EIRButtonType::Yes ? TEXT("YES") : TEXT("NO"));
 }
 
 void UIRButtonComponent::UpdateAnimation(float DeltaTime)
@@ -214,6 +229,7 @@ void UIRButtonComponent::UpdateAnimation(float DeltaTime)
 		// Fire event when pressed animation completes
 		if (bIsPressed)
 		{
+			UDiceEventBus::Broadcast(this, FDiceButtonPressedEvent{ this, ButtonType });
 			OnButtonPressed.Broadcast(ButtonType);
 		}
 	}
@@ -238,13 +254,13 @@ void UIRButtonComponent::UpdateLabelText()
 
 	if (ButtonType == EIRButtonType::Yes)
 	{
-		Label->SetText(FText::FromString(TEXT("YES")));
-		Label->SetTextRenderColor(FColor(100, 255, 100, 255));  // Green
+		UDiceLabelBatcher::SetText(Label, FText::FromString(TEXT("YES")));
+		UDiceLabelBatcher::SetColor(Label, FColor(100, 255, 100, 255));  // Green
 	}
 	else
 	{
-		Label->SetText(FText::FromString(TEXT("NO")));
-		Label->SetTextRenderColor(FColor(255, 100, 100, 255));  // Red
+		UDiceLabelBatcher::SetText(Label, FText::FromString(TEXT("NO")));
+		UDiceLabelBatcher::SetColor(Label, FColor(255, 100, 100, 255));  // Red
 	}
 }
 
@@ -253,9 +269,6 @@ void UIRButtonComponent::StartCameraFocus()
 	if (!DiceCamera) DiceCamera = FindDiceCamera();
 	if (!DiceCamera) return;
 
-	OriginalCameraPos = DiceCamera->GetActorLocation();
-	OriginalCameraRot = DiceCamera->GetActorRotation();
-
 	AActor* Owner = GetOwner();
 	if (Owner)
 	{
@@ -275,6 +288,8 @@ void UIRButtonComponent::StartCameraFocus()
 
 void UIRButtonComponent::StartCameraReturn()
 {
+	if (!DiceCamera) return;
+
 	CameraProgress = 0.0f;
 	bCameraFocusing = false;
 	bCameraReturning = true;
@@ -284,89 +299,33 @@ void UIRButtonComponent::UpdateCameraFocus(float DeltaTime)
 {
 	if (!DiceCamera) return;
 
+	// Blend the ButtonFocus layer in and back out - whatever sits below it is where we return to
 	if (bCameraFocusing)
 	{
-		CameraProgress += DeltaTime * CameraFocusSpeed;
+		CameraProgress = FMath::Min(CameraProgress + DeltaTime * CameraFocusSpeed, 1.0f);
+		DiceCamera->SetPoseLayer(ECameraLayer::ButtonFocus, TargetCameraPos, TargetCameraRot, EaseOutCubic(CameraProgress));
 
 		if (CameraProgress >= 1.0f)
 		{
-			CameraProgress = 1.0f;
 			bCameraFocusing = false;
-			DiceCamera->SetActorLocation(TargetCameraPos);
-			DiceCamera->SetActorRotation(TargetCameraRot);
-		}
-		else
-		{
-			float T = EaseOutCubic(CameraProgress);
-			FVector NewPos = FMath::Lerp(OriginalCameraPos, TargetCameraPos, T);
-			FRotator NewRot = FMath::Lerp(OriginalCameraRot, TargetCameraRot, T);
-			DiceCamera->SetActorLocation(NewPos);
-			DiceCamera->SetActorRotation(NewRot);
 		}
 	}
 	else if (bCameraReturning)
 	{
-		CameraProgress += DeltaTime * CameraFocusSpeed;
+		CameraProgress = FMath::Min(CameraProgress + DeltaTime * CameraFocusSpeed, 1.0f);
+		DiceCamera->SetPoseLayer(ECameraLayer::ButtonFocus, TargetCameraPos, TargetCameraRot, 1.0f - EaseOutCubic(CameraProgress));
 
 		if (CameraProgress >= 1.0f)
 		{
-			CameraProgress = 1.0f;
 			bCameraReturning = false;
-			DiceCamera->SetActorLocation(OriginalCameraPos);
-			DiceCamera->SetActorRotation(OriginalCameraRot);
-		}
-		else
-		{
-			float T = EaseOutCubic(CameraProgress);
-			FVector CurrentPos = DiceCamera->GetActorLocation();
-			FRotator CurrentRot = DiceCamera->GetActorRotation();
-
-			FVector NewPos = FMath::Lerp(CurrentPos, OriginalCameraPos, T);
-			FRotator NewRot = FMath::Lerp(CurrentRot, OriginalCameraRot, T);
-			DiceCamera->SetActorLocation(NewPos);
-			DiceCamera->SetActorRotation(NewRot);
+			DiceCamera->ClearPoseLayer(ECameraLayer::ButtonFocus);
 		}
 	}
 }
 
-bool UIRButtonComponent::IsMouseOverSwitch()
-{
-	if (!SwitchMesh) return false;
-
-	APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
-	if (!PC) return false;
-
-	FVector WorldLocation, WorldDirection;
-	if (!PC->DeprojectMousePositionToWorld(WorldLocation, WorldDirection))
-		return false;
-
-	FHitResult HitResult;
-	FVector TraceEnd = WorldLocation + WorldDirection * 5000.0f;
-
-	FCollisionQueryParams Params;
-	Params.AddIgnoredActor(PC->GetPawn());
-
-	if (GetWorld()->LineTraceSingleByChannel(HitResult, WorldLocation, TraceEnd, ECC_Visibility, Params))
-	{
-		if (HitResult.GetComponent() == SwitchMesh)
-		{
-			return true;
-		}
-	}
-
-	return false;
-}
-
 ADiceCamera* UIRButtonComponent::FindDiceCamera()
 {
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ADiceCamera::StaticClass(), FoundActors);
-
-	if (FoundActors.Num() > 0)
-	{
-		return Cast<ADiceCamera>(FoundActors[0]);
-	}
-	return nullptr;
+	return ADiceCamera::Get(this);
 }
 
 float UIRButtonComponent::EaseOutElastic(float t)
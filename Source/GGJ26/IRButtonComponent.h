@@ -2,9 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "InputCoreTypes.h"
 #include "IRButtonComponent.generated.h"
 
 class UStaticMeshComponent;
+class UPrimitiveComponent;
 class UTextRenderComponent;
 class ADiceCamera;
 
@@ -81,6 +83,9 @@ public:
 	void ResetButton();
 
 private:
+	UFUNCTION()
+	void HandleSwitchClicked(UPrimitiveComponent* TouchedComponent, FKey ButtonPressed);
+
 	UStaticMeshComponent* SwitchMesh;
 	UStaticMeshComponent* BaseMesh;
 	UTextRenderComponent* Label;
@@ -92,13 +97,8 @@ private:
 	FVector SwitchPressedPos;
 	float AnimProgress;
 
-	// Mouse tracking (per-instance, not shared)
-	bool bWasMouseDown;
-
 	// Camera
 	ADiceCamera* DiceCamera;
-	FVector OriginalCameraPos;
-	FRotator OriginalCameraRot;
 	FVector TargetCameraPos;
 	FRotator TargetCameraRot;
 	float CameraProgress;
@@ -106,11 +106,11 @@ private:
 	bool bCameraReturning;
 
 	void OnClicked();
+	void RefreshTickEnabled();
 	void UpdateAnimation(float DeltaTime);
 	void UpdateCameraFocus(float DeltaTime);
 	void ApplySwitchPosition(FVector Position);
 	void UpdateLabelText();
-	bool IsMouseOverSwitch();
 
 	void StartCameraFocus();
 	void StartCameraReturn();
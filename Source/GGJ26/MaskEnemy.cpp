@@ -1,5 +1,7 @@
 #include "MaskEnemy.h"
 #include "Components/StaticMeshComponent.h"
+#include "DiceGameManager.h"
+#include "DiceSignificance.h"
 
 AMaskEnemy::AMaskEnemy()
 {
@@ -40,6 +42,16 @@ void AMaskEnemy::BeginPlay()
 	}
 
 	InitialLocation = GetActorLocation();
+
+	// The bob is pure ambience - full rate only while the enemy is the one throwing
+	if (UDiceSignificanceManager* Significance = UDiceSignificanceManager::Get(this))
+	{
+		Significance->Register(this, PrimaryActorTick, Mesh, [](EGamePhase Phase)
+		{
+			return (Phase == EGamePhase::EnemyThrowing || Phase == EGamePhase::EnemyDiceSettling)
+				? EDiceSignificance::High : EDiceSignificance::Medium;
+		});
+	}
 }
 
 void AMaskEnemy::Tick(float DeltaTime)
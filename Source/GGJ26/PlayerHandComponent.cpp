@@ -1,4 +1,5 @@
 #include "PlayerHandComponent.h"
+#include "GGJ26.h"
 #include "DiceCamera.h"
 #include "SoundManager.h"
 #include "Components/StaticMeshComponent.h"
@@ -6,6 +7,10 @@
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
+#include "DiceTimerWheel.h"
+#include "DiceEventBus.h"
+#include "DiceSignificance.h"
+#include "DiceDebris.h"
 
 UPlayerHandComponent::UPlayerHandComponent()
 {
@@ -64,6 +69,7 @@ UPlayerHandComponent::UPlayerHandComponent()
 	BloodColor = FLinearColor(0.5f, 0.0f, 0.0f, 1.0f);  // Dark red
 	BloodSplatterCount = 5;
 	BloodSplatterSpread = 20.0f;
+	bBloodHasBurstParams = false;
 
 	// Camera zoom (subtle for enemy hand)
 	ChopCameraZoomAmount = 25.0f;  // Subtle zoom
@@ -71,10 +77,9 @@ UPlayerHandComponent::UPlayerHandComponent()
 	bCameraZooming = false;
 	CameraZoomProgress = 0.0f;
 	bCameraZoomingOut = false;
-	CameraZoomOriginalPos = FVector::ZeroVector;
-	CameraZoomOriginalRot = FRotator::ZeroRotator;
+	CameraZoomWeight = 0.0f;
+	CameraZoomStartWeight = 0.0f;
 	ShakeOffset = FVector::ZeroVector;
-	CachedDiceCamera = nullptr;
 
 	CurrentFingerToChop = 5;  // Start with pinky
 	FingersRemaining = 5;
@@ -127,7 +132,7 @@ void UPlayerHandComponent::BeginPlay()
 		}
 
 		// Log what we found
-		UE_LOG(LogTemp, Log, TEXT("PlayerHand - Found meshes: Palm=%s, F1=%s, F2=%s, F3=%s, F4=%s, F5=%s"),
+		UE_LOG(LogDiceGame, Verbose, TEXT("PlayerHand - Found meshes: Palm=%s, F1=%s, F2=%s, F3=%s, F4=%s, F5=%s"),
 			PalmMesh ? TEXT("Yes") : TEXT("No"),
 			Finger1 ? TEXT("Yes") : TEXT("No"),
 			Finger2 ? TEXT("Yes") : TEXT("No"),
@@ -135,7 +140,7 @@ void UPlayerHandComponent::BeginPlay()
 			Finger4 ? TEXT("Yes") : TEXT("No"),
 			Finger5 ? TEXT("Yes") : TEXT("No"));
 
-		UE_LOG(LogTemp, Log, TEXT("PlayerHand - Knives: K1=%s, K2=%s, K3=%s, K4=%s, K5=%s"),
+		UE_LOG(LogDiceGame, Verbose, TEXT("PlayerHand - Knives: K1=%s, K2=%s, K3=%s, K4=%s, K5=%s"),
 			Knife1 ? TEXT("Yes") : TEXT("No"),
 			Knife2 ? TEXT("Yes") : TEXT("No"),
 			Knife3 ? TEXT("Yes") : TEXT("No"),
@@ -144,6 +149,7 @@ void UPlayerHandComponent::BeginPlay()
 	}
 
 	SetupInputBindings();
+	CreateBloodPool();
 
 	// Move all knives up to start position
 	TArray<UStaticMeshComponent*> Knives = { Knife1, Knife2, Knife3, Knife4, Knife5 };
@@ -209,7 +215,7 @@ void UPlayerHandComponent::ChopNextFinger()
 
 	if (!CurrentKnife || !CurrentFinger)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Missing knife or finger mesh for finger %d"), CurrentFingerToChop);
+		UE_LOG(LogDiceGame, Warning, TEXT("Missing knife or finger mesh for finger %d"), CurrentFingerToChop);
 		return;
 	}
 
@@ -323,13 +329,19 @@ void UPlayerHandComponent::FinishChop()
 			FMath::RandRange(-30.0f, 30.0f)
 		);
 		CurrentFinger->AddAngularImpulseInDegrees(Torque, NAME_None, true);
+
+		// Frozen once it lands, recycled once too many pile up
+		if (UDiceDebrisManager* Debris = UDiceDebrisManager::Get(this))
+		{
+			Debris->Track(CurrentFinger);
+		}
 	}
 
 	// Update state
 	CurrentFingerToChop--;
 	FingersRemaining--;
 
-	UE_LOG(LogTemp, Log, TEXT("Finger chopped! Remaining: %d"), FingersRemaining);
+	UE_LOG(LogDiceGame, Verbose, TEXT("Finger chopped! Remaining: %d"), FingersRemaining);
 
 	// Start knife return animation
 	StartKnifeReturn();
@@ -354,16 +366,6 @@ void UPlayerHandComponent::PlayCameraShake()
 	bCameraShaking = true;
 	CameraShakeTimer = 0.0f;
 	ShakeOffset = FVector::ZeroVector;
-
-	// Store original camera position if not zooming (for player hand)
-	if (!bCameraZooming)
-	{
-		ADiceCamera* Cam = FindDiceCamera();
-		if (Cam)
-		{
-			CameraZoomOriginalPos = Cam->GetActorLocation();
-		}
-	}
 }
 
 void UPlayerHandComponent::UpdateCameraShake(float DeltaTime)
@@ -375,15 +377,9 @@ void UPlayerHandComponent::UpdateCameraShake(float DeltaTime)
 		bCameraShaking = false;
 		ShakeOffset = FVector::ZeroVector;
 
-		// Reset camera to original position if not zooming
-		if (!bCameraZooming && !CameraZoomOriginalPos.IsZero())
+		if (ADiceCamera* Cam = FindDiceCamera())
 		{
-			ADiceCamera* Cam = FindDiceCamera();
-			if (Cam)
-			{
-				Cam->SetActorLocation(CameraZoomOriginalPos);
-			}
-			CameraZoomOriginalPos = FVector::ZeroVector;
+			Cam->ClearOffsetLayer(ECameraOffset::HandShake);
 		}
 		return;
 	}
@@ -392,24 +388,17 @@ void UPlayerHandComponent::UpdateCameraShake(float DeltaTime)
 	float Progress = CameraShakeTimer / CamShakeDuration;
 	float CurrentIntensity = CamShakeIntensity * (1.0f - Progress * Progress);  // Quadratic falloff
 
-	// Calculate shake offset (will be applied in UpdateCameraZoom or directly)
 	ShakeOffset = FVector(
 		FMath::RandRange(-CurrentIntensity, CurrentIntensity),
 		FMath::RandRange(-CurrentIntensity, CurrentIntensity),
 		FMath::RandRange(-CurrentIntensity * 0.5f, CurrentIntensity * 0.5f)
 	);
 
-	// If not zooming, apply shake directly to DiceCamera
-	if (!bCameraZooming)
+	// Added on top of whatever pose the camera ends up in (zoom included)
+	if (ADiceCamera* Cam = FindDiceCamera())
 	{
-		ADiceCamera* Cam = FindDiceCamera();
-		if (Cam)
-		{
-			FVector BasePos = CameraZoomOriginalPos.IsZero() ? Cam->GetActorLocation() : CameraZoomOriginalPos;
-			Cam->SetActorLocation(BasePos + ShakeOffset);
-		}
+		Cam->SetOffsetLayer(ECameraOffset::HandShake, ShakeOffset);
 	}
-	// If zooming, the shake offset will be applied in UpdateCameraZoom
 }
 
 void UPlayerHandComponent::UpdateAnimation(float DeltaTime)
@@ -439,22 +428,26 @@ void UPlayerHandComponent::UpdateAnimation(float DeltaTime)
 
 			if (Alpha >= 1.0f)
 			{
-				// Start waiting
+				// Start waiting - the wheel kicks off the slice
 				AnimationPhase = 2;
 				AnimationTimer = 0.0f;
+				if (UDiceTimerWheel* Wheel = UDiceTimerWheel::Get(this))
+				{
+					SliceDelayHandle = Wheel->Schedule(this, WaitTimeBeforeSlice, [this]()
+					{
+						if (AnimationPhase == 2) StartSlice();
+					});
+				}
+				else
+				{
+					StartSlice();
+				}
 			}
 			break;
 		}
 
-		case 2:  // Waiting before slice
-		{
-			AnimationTimer += DeltaTime;
-			if (AnimationTimer >= WaitTimeBeforeSlice)
-			{
-				StartSlice();
-			}
+		case 2:  // Waiting before slice (SliceDelayHandle)
 			break;
-		}
 
 		case 3:  // Slicing
 		{
@@ -513,7 +506,8 @@ void UPlayerHandComponent::UpdateAnimation(float DeltaTime)
 				CurrentKnife = nullptr;
 				CurrentFinger = nullptr;
 
-				// Broadcast chop complete event
+				// Broadcast chop complete event (dynamic delegate is the Blueprint mirror)
+				UDiceEventBus::Broadcast(this, FDiceChopCompleteEvent{ this });
 				OnChopComplete.Broadcast();
 			}
 			break;
@@ -550,78 +544,134 @@ UStaticMeshComponent* UPlayerHandComponent::GetKnifeMesh(int32 FingerIndex)
 	}
 }
 
-void UPlayerHandComponent::SpawnBloodVFX()
+void UPlayerHandComponent::CreateBloodPool()
 {
-	if (!CurrentKnife) return;
+	BloodPool.Reset();
+	BloodColorParams.Reset();
+	bBloodHasBurstParams = false;
 
-	// Get slice position (where the knife is)
-	FVector SlicePos = CurrentKnife->GetComponentLocation();
+	if (!BloodParticleSystem || !GetOwner())
+	{
+		return;
+	}
 
-	// Spawn main blood burst at slice point
-	if (BloodParticleSystem)
-	{
-		// Spawn at knife position, pointing down for drip effect
-		FRotator ParticleRot = FRotator(-90.0f, 0, 0);
-
-		UNiagaraComponent* BloodFX = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			GetWorld(),
-			BloodParticleSystem,
-			SlicePos,
-			ParticleRot,
-			FVector(1.0f),
-			true,
-			true,
-			ENCPoolMethod::None,
-			true
-		);
+	UNiagaraComponent* Main = CreateBloodComponent();
+	if (!Main)
+	{
+		return;
+	}
+	BloodPool.Add(Main);
 
-		if (BloodFX)
+	// Resolve the user parameters once - only the ones the system actually exposes get written per chop
+	const FNiagaraUserRedirectionParameterStore& Params = Main->GetOverrideParameters();
+	for (const TCHAR* ColorName : { TEXT("User.Color"), TEXT("User.BloodColor"), TEXT("User.ParticleColor") })
+	{
+		FNiagaraVariable ColorParam(FNiagaraTypeDefinition::GetColorDef(), FName(ColorName));
+		if (Params.IndexOf(ColorParam) != INDEX_NONE)
 		{
-			// Set color parameters - try common naming conventions
-			BloodFX->SetColorParameter(TEXT("Color"), BloodColor);
-			BloodFX->SetColorParameter(TEXT("BloodColor"), BloodColor);
-			BloodFX->SetColorParameter(TEXT("ParticleColor"), BloodColor);
+			BloodColorParams.Add(ColorParam);
 		}
+	}
 
-		// Spawn splatter particles around the slice
+	BloodBurstCountParam = FNiagaraVariable(FNiagaraTypeDefinition::GetIntDef(), FName(TEXT("User.BurstCount")));
+	BloodBurstSpreadParam = FNiagaraVariable(FNiagaraTypeDefinition::GetFloatDef(), FName(TEXT("User.BurstSpread")));
+	bBloodHasBurstParams = Params.IndexOf(BloodBurstCountParam) != INDEX_NONE;
+
+	// No burst parameters - keep one component per splatter around instead of spawning them on the chop
+	if (!bBloodHasBurstParams)
+	{
 		for (int32 i = 0; i < BloodSplatterCount; i++)
 		{
-			FVector SplatterOffset = FVector(
-				FMath::RandRange(-BloodSplatterSpread, BloodSplatterSpread),
-				FMath::RandRange(-BloodSplatterSpread, BloodSplatterSpread),
-				FMath::RandRange(-5.0f, 5.0f)
-			);
-
-			FVector SplatterPos = SlicePos + SplatterOffset;
-			float SplatterScale = FMath::RandRange(0.3f, 0.7f);
-			FRotator SplatterRot = FRotator(
-				FMath::RandRange(-45.0f, 45.0f),
-				FMath::RandRange(0.0f, 360.0f),
-				0
-			);
-
-			UNiagaraComponent* SplatterFX = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(),
-				BloodParticleSystem,
-				SplatterPos,
-				SplatterRot,
-				FVector(SplatterScale),
-				true,
-				true,
-				ENCPoolMethod::None,
-				true
-			);
-
-			if (SplatterFX)
+			if (UNiagaraComponent* Splatter = CreateBloodComponent())
 			{
-				SplatterFX->SetColorParameter(TEXT("Color"), BloodColor);
-				SplatterFX->SetColorParameter(TEXT("BloodColor"), BloodColor);
-				SplatterFX->SetColorParameter(TEXT("ParticleColor"), BloodColor);
+				BloodPool.Add(Splatter);
 			}
 		}
 	}
 }
 
+UNiagaraComponent* UPlayerHandComponent::CreateBloodComponent()
+{
+	UNiagaraComponent* Blood = NewObject<UNiagaraComponent>(GetOwner());
+	if (!Blood)
+	{
+		return nullptr;
+	}
+
+	Blood->SetAutoActivate(false);
+	Blood->SetAutoDestroy(false);
+	Blood->SetUsingAbsoluteLocation(true);
+	Blood->SetUsingAbsoluteRotation(true);
+	Blood->SetUsingAbsoluteScale(true);
+	Blood->SetAsset(BloodParticleSystem);
+	Blood->RegisterComponent();
+
+	// Build the system instance now rather than on the first chop
+	Blood->InitializeSystem();
+	return Blood;
+}
+
+void UPlayerHandComponent::FireBlood(UNiagaraComponent* Blood, const FVector& Location, const FRotator& Rotation, float Scale)
+{
+	Blood->SetWorldLocationAndRotation(Location, Rotation);
+	Blood->SetWorldScale3D(FVector(Scale));
+
+	FNiagaraUserRedirectionParameterStore& Params = Blood->GetOverrideParameters();
+	for (const FNiagaraVariable& ColorParam : BloodColorParams)
+	{
+		Params.SetParameterValue(BloodColor, ColorParam);
+	}
+
+	Blood->Activate(true);  // Reset - restarts the burst if the last one is still playing
+}
+
+void UPlayerHandComponent::SpawnBloodVFX()
+{
+	if (!CurrentKnife || BloodPool.Num() == 0) return;
+
+	// Get slice position (where the knife is)
+	FVector SlicePos = CurrentKnife->GetComponentLocation();
+
+	// Fewer splatters when the frame governor is under pressure
+	const float CosmeticScale = UDiceSignificanceManager::CosmeticScaleFor(this);
+	const int32 SplatterCount = BloodSplatterCount > 0 ? FMath::Max(1, FMath::RoundToInt(BloodSplatterCount * CosmeticScale)) : 0;
+
+	// Main blood burst at the knife, pointing down for drip effect
+	UNiagaraComponent* Main = BloodPool[0];
+	if (bBloodHasBurstParams)
+	{
+		// The splatter is just more particles in the same burst
+		FNiagaraUserRedirectionParameterStore& Params = Main->GetOverrideParameters();
+		Params.SetParameterValue(SplatterCount, BloodBurstCountParam);
+		Params.SetParameterValue(BloodSplatterSpread, BloodBurstSpreadParam);
+	}
+	FireBlood(Main, SlicePos, FRotator(-90.0f, 0, 0), 1.0f);
+
+	if (bBloodHasBurstParams)
+	{
+		return;
+	}
+
+	// Splatter around the slice from the pre-warmed components
+	const int32 NumSplatters = FMath::Min(SplatterCount, BloodPool.Num() - 1);
+	for (int32 i = 0; i < NumSplatters; i++)
+	{
+		FVector SplatterOffset = FVector(
+			FMath::RandRange(-BloodSplatterSpread, BloodSplatterSpread),
+			FMath::RandRange(-BloodSplatterSpread, BloodSplatterSpread),
+			FMath::RandRange(-5.0f, 5.0f)
+		);
+
+		FRotator SplatterRot = FRotator(
+			FMath::RandRange(-45.0f, 45.0f),
+			FMath::RandRange(0.0f, 360.0f),
+			0
+		);
+
+		FireBlood(BloodPool[i + 1], SlicePos + SplatterOffset, SplatterRot, FMath::RandRange(0.3f, 0.7f));
+	}
+}
+
 void UPlayerHandComponent::StartCameraZoomIn()
 {
 	ADiceCamera* Cam = FindDiceCamera();
@@ -630,21 +680,23 @@ void UPlayerHandComponent::StartCameraZoomIn()
 		bCameraZooming = true;
 		bCameraZoomingOut = false;
 		CameraZoomProgress = 0.0f;
-		CameraZoomStartPos = Cam->GetActorLocation();
-		CameraZoomStartRot = Cam->GetActorRotation();
-		CameraZoomOriginalPos = CameraZoomStartPos;
-		CameraZoomOriginalRot = CameraZoomStartRot;
+		CameraZoomStartWeight = 0.0f;
+
+		// Zoom from wherever the layers below put the camera
+		FVector StartPos;
+		FRotator StartRot;
+		Cam->GetPoseBelow(ECameraLayer::HandZoom, StartPos, StartRot);
 
 		// Zoom toward the hand
 		FVector HandPos = GetOwner()->GetActorLocation();
-		FVector ToHand = (HandPos - CameraZoomStartPos).GetSafeNormal();
-		CameraZoomTargetPos = CameraZoomStartPos + ToHand * ChopCameraZoomAmount;
+		FVector ToHand = (HandPos - StartPos).GetSafeNormal();
+		CameraZoomTargetPos = StartPos + ToHand * ChopCameraZoomAmount;
 
 		// Rotate to look at the hand (subtle)
 		FVector LookDir = (HandPos - CameraZoomTargetPos).GetSafeNormal();
 		CameraZoomTargetRot = LookDir.Rotation();
 		// Blend with original rotation for subtlety
-		CameraZoomTargetRot = FMath::Lerp(CameraZoomStartRot, CameraZoomTargetRot, 0.3f);
+		CameraZoomTargetRot = FMath::Lerp(StartRot, CameraZoomTargetRot, 0.3f);
 	}
 }
 
@@ -656,15 +708,8 @@ void UPlayerHandComponent::StartCameraZoomOut()
 		bCameraZoomingOut = true;
 		CameraZoomProgress = 0.0f;
 
-		ADiceCamera* Cam = FindDiceCamera();
-		if (Cam)
-		{
-			// Swap start and target - go back to original position and rotation
-			CameraZoomStartPos = Cam->GetActorLocation();
-			CameraZoomStartRot = Cam->GetActorRotation();
-			CameraZoomTargetPos = CameraZoomOriginalPos;
-			CameraZoomTargetRot = CameraZoomOriginalRot;
-		}
+		// Fade the layer back out from wherever the zoom in got to
+		CameraZoomStartWeight = CameraZoomWeight;
 	}
 }
 
@@ -688,20 +733,12 @@ void UPlayerHandComponent::UpdateCameraZoom(float DeltaTime)
 			: 1.0f - FMath::Pow(-2.0f * Alpha + 2.0f, 2.0f) / 2.0f;
 	}
 
+	CameraZoomWeight = bCameraZoomingOut ? FMath::Lerp(CameraZoomStartWeight, 0.0f, EasedAlpha) : EasedAlpha;
+
 	ADiceCamera* Cam = FindDiceCamera();
 	if (Cam)
 	{
-		FVector NewPos = FMath::Lerp(CameraZoomStartPos, CameraZoomTargetPos, EasedAlpha);
-		FRotator NewRot = FMath::Lerp(CameraZoomStartRot, CameraZoomTargetRot, EasedAlpha);
-
-		// Apply shake offset on top of zoom position
-		if (bCameraShaking)
-		{
-			NewPos += ShakeOffset;
-		}
-
-		Cam->SetActorLocation(NewPos);
-		Cam->SetActorRotation(NewRot);
+		Cam->SetPoseLayer(ECameraLayer::HandZoom, CameraZoomTargetPos, CameraZoomTargetRot, CameraZoomWeight);
 	}
 
 	if (Alpha >= 1.0f)
@@ -709,8 +746,11 @@ void UPlayerHandComponent::UpdateCameraZoom(float DeltaTime)
 		if (bCameraZoomingOut)
 		{
 			bCameraZooming = false;
-			CameraZoomOriginalPos = FVector::ZeroVector;
-			CameraZoomOriginalRot = FRotator::ZeroRotator;
+			CameraZoomWeight = 0.0f;
+			if (Cam)
+			{
+				Cam->ClearPoseLayer(ECameraLayer::HandZoom);
+			}
 		}
 		// If zooming in, wait for zoom out to be triggered
 	}
@@ -718,29 +758,5 @@ void UPlayerHandComponent::UpdateCameraZoom(float DeltaTime)
 
 ADiceCamera* UPlayerHandComponent::FindDiceCamera()
 {
-	if (CachedDiceCamera && IsValid(CachedDiceCamera))
-	{
-		return CachedDiceCamera;
-	}
-
-	TArray<AActor*> FoundCameras;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ADiceCamera::StaticClass(), FoundCameras);
-	for (AActor* A : FoundCameras)
-	{
-		ADiceCamera* Cam = Cast<ADiceCamera>(A);
-		if (Cam && Cam->bIsMainCamera)
-		{
-			CachedDiceCamera = Cam;
-			return Cam;
-		}
-	}
-
-	// If no main camera found, use the first one
-	if (FoundCameras.Num() > 0)
-	{
-		CachedDiceCamera = Cast<ADiceCamera>(FoundCameras[0]);
-		return CachedDiceCamera;
-	}
-
-	return nullptr;
+	return ADiceCamera::Get(this);
 }
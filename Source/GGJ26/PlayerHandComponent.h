@@ -4,6 +4,8 @@
 #include "Components/ActorComponent.h"
 #include "NiagaraSystem.h"
 #include "NiagaraFunctionLibrary.h"
+#include "NiagaraTypes.h"
+#include "DiceTimerWheel.h"
 #include "PlayerHandComponent.generated.h"
 
 class UStaticMeshComponent;
@@ -156,6 +158,8 @@ public:
 	ASoundManager* SoundManager;
 
 	// Blood VFX
+	// Exposing int User.BurstCount and float User.BurstSpread lets one component play the whole splatter;
+	// systems without them get a pre-warmed component per splatter instead
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Blood VFX")
 	UNiagaraSystem* BloodParticleSystem;
 
@@ -199,6 +203,7 @@ private:
 	bool bIsAnimating;
 	int32 AnimationPhase;  // 0=idle, 1=knife coming down, 2=waiting, 3=slicing, 4=returning up, 5=done
 	float AnimationTimer;
+	FDiceTimerHandle SliceDelayHandle;
 	FVector KnifeAnimStartPos;
 	FVector KnifeAnimTargetPos;
 	FVector KnifeReturnPos;  // Where knife returns to
@@ -219,6 +224,19 @@ private:
 	void UpdateCameraShake(float DeltaTime);
 	void SpawnBloodVFX();
 
+	// Blood pool - created and initialized at BeginPlay, re-fired on every chop
+	UPROPERTY(Transient)
+	TArray<UNiagaraComponent*> BloodPool;  // [0] = main burst, the rest only when the system has no burst parameters
+
+	TArray<FNiagaraVariable> BloodColorParams;  // Whichever colour names the system exposes, resolved once
+	FNiagaraVariable BloodBurstCountParam;
+	FNiagaraVariable BloodBurstSpreadParam;
+	bool bBloodHasBurstParams;
+
+	void CreateBloodPool();
+	UNiagaraComponent* CreateBloodComponent();
+	void FireBlood(UNiagaraComponent* Blood, const FVector& Location, const FRotator& Rotation, float Scale);
+
 	// Camera shake state
 	bool bCameraShaking;
 	float CameraShakeTimer;
@@ -227,19 +245,16 @@ private:
 	// Camera zoom state
 	bool bCameraZooming;
 	float CameraZoomProgress;
-	FVector CameraZoomStartPos;
 	FVector CameraZoomTargetPos;
-	FVector CameraZoomOriginalPos;  // Original position before any zoom
-	FRotator CameraZoomStartRot;
 	FRotator CameraZoomTargetRot;
-	FRotator CameraZoomOriginalRot;
+	float CameraZoomWeight;       // Current HandZoom layer weight
+	float CameraZoomStartWeight;  // Weight the zoom out fades from
 	bool bCameraZoomingOut;
 
 	void StartCameraZoomIn();
 	void StartCameraZoomOut();
 	void UpdateCameraZoom(float DeltaTime);
 	ADiceCamera* FindDiceCamera();
-	ADiceCamera* CachedDiceCamera;
 
 	UStaticMeshComponent* GetFingerMesh(int32 FingerIndex);
 	UStaticMeshComponent* GetKnifeMesh(int32 FingerIndex);
@@ -1,6 +1,15 @@
 #include "RoundTimerComponent.h"
+#include "GGJ26.h"
 #include "Components/TextRenderComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "DiceTimerWheel.h"
+#include "DiceEventBus.h"
+#include "DiceGameManager.h"
+#include "DiceSignificance.h"
+#include "DiceTextRevealComponent.h"
+#include "DiceLabelBatcher.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Timer Text Rebuilds/s"), STAT_DiceTimerTextRebuildsPerSecond, STATGROUP_DiceGame);
 
 URoundTimerComponent::URoundTimerComponent()
 {
@@ -18,17 +27,17 @@ URoundTimerComponent::URoundTimerComponent()
 	bIsRunning = false;
 
 	TimerLabel = nullptr;
+	TextReveal = nullptr;
+	DisplayedColor = FColor::Transparent;
+	DisplayedCentis = INDEX_NONE;
+	LastTextPushes = 0;
+	TextRebuildWindow = 0.0f;
 
 	// Text reveal animation
-	bTextRevealing = false;
-	TextRevealProgress = 0.0f;
 	TextRevealSpeed = 15.0f;  // Characters per second
-	TargetText = TEXT("");
-	RevealedCharCount = 0;
 
 	// Idle cycle
 	IdleCycleTime = 2.0f;  // Switch every 2 seconds
-	IdleCycleTimer = 0.0f;
 	IdleCycleIndex = 0;
 	LastIdleText = TEXT("");
 }
@@ -60,6 +69,26 @@ void URoundTimerComponent::BeginPlay()
 		}
 	}
 
+	UDiceLabelBatcher::Adopt(TimerLabel);
+
+	TextReveal = UDiceTextRevealComponent::FindOrCreate(Owner, TimerLabel);
+	if (TextReveal)
+	{
+		TextReveal->Mode = ETextRevealMode::Scramble;
+		TextReveal->CharsPerSecond = TextRevealSpeed;
+		TextReveal->ScrambleChars = TEXT("0123456789ABCDEFX#@%");
+		TextReveal->OnRevealFinished.AddUObject(this, &URoundTimerComponent::HandleRevealFinished);
+	}
+
+	// The countdown is gameplay - between rounds the label only shows state text (reveals animate themselves)
+	if (UDiceSignificanceManager* Significance = UDiceSignificanceManager::Get(this))
+	{
+		Significance->Register(this, PrimaryComponentTick, TimerLabel, [this](EGamePhase)
+		{
+			return CurrentState == ETimerState::Countdown ? EDiceSignificance::Critical : EDiceSignificance::Medium;
+		});
+	}
+
 	// Start in idle state
 	SetIdle();
 }
@@ -78,47 +107,39 @@ void URoundTimerComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 			TimeRemaining = 0.0f;
 			bIsRunning = false;
 			CurrentState = ETimerState::TimeUp;
+			UDiceSignificanceManager::RefreshFor(this);
+			UDiceEventBus::Broadcast(this, FDiceTimerExpiredEvent{ this });
 			OnTimerExpired.Broadcast();
 		}
 	}
 
-	// Handle idle cycling
-	if (CurrentState == ETimerState::Idle && !bTextRevealing)
-	{
-		IdleCycleTimer += DeltaTime;
-		if (IdleCycleTimer >= IdleCycleTime)
-		{
-			IdleCycleTimer = 0.0f;
-			IdleCycleIndex = (IdleCycleIndex + 1) % 2;
-
-			FString NewText = (IdleCycleIndex == 0) ? TEXT("WELCOME") : TEXT("Miss Ada");
-			if (NewText != LastIdleText)
-			{
-				LastIdleText = NewText;
-				StartTextReveal(NewText);
-			}
-		}
-	}
+	// Update display
+	UpdateDisplay();
 
-	// Handle text reveal animation
-	if (bTextRevealing)
+	TextRebuildWindow += DeltaTime;
+	if (TextRebuildWindow >= 1.0f && TextReveal)
 	{
-		UpdateTextReveal(DeltaTime);
+		const int32 Pushes = TextReveal->GetNumTextPushes();
+		SET_DWORD_STAT(STAT_DiceTimerTextRebuildsPerSecond, FMath::RoundToInt((Pushes - LastTextPushes) / TextRebuildWindow));
+		LastTextPushes = Pushes;
+		TextRebuildWindow = 0.0f;
 	}
-
-	// Update display
-	UpdateDisplay();
 }
 
 void URoundTimerComponent::SetState(ETimerState NewState)
 {
 	CurrentState = NewState;
 
+	// Idle cycle is re-armed when the next idle reveal finishes
+	if (UDiceTimerWheel* Wheel = UDiceTimerWheel::Get(this))
+	{
+		Wheel->Cancel(IdleCycleHandle);
+	}
+
 	switch (NewState)
 	{
 		case ETimerState::Idle:
 			bIsRunning = false;
-			IdleCycleTimer = 0.0f;
 			IdleCycleIndex = 0;
 			break;
 		case ETimerState::Hold:
@@ -137,6 +158,8 @@ void URoundTimerComponent::SetState(ETimerState NewState)
 			bIsRunning = false;
 			break;
 	}
+
+	UDiceSignificanceManager::RefreshFor(this);
 }
 
 void URoundTimerComponent::StartCountdown()
@@ -144,9 +167,7 @@ void URoundTimerComponent::StartCountdown()
 	CurrentState = ETimerState::Countdown;
 	TimeRemaining = RoundTime;
 	bIsRunning = true;
-
-	// Start reveal animation for initial time display
-	StartTextReveal(FormatTime(TimeRemaining));
+	UDiceSignificanceManager::RefreshFor(this);
 }
 
 void URoundTimerComponent::StopCountdown()
@@ -159,6 +180,12 @@ void URoundTimerComponent::ResetTimer()
 	TimeRemaining = RoundTime;
 	bIsRunning = false;
 	CurrentState = ETimerState::Idle;
+	UDiceSignificanceManager::RefreshFor(this);
+
+	if (!TextReveal || !TextReveal->IsRevealing())
+	{
+		ScheduleIdleCycle();
+	}
 }
 
 void URoundTimerComponent::SetIdle()
@@ -188,117 +215,104 @@ void URoundTimerComponent::SetPlayerReady()
 
 void URoundTimerComponent::StartTextReveal(const FString& NewText)
 {
-	TargetText = NewText;
-	bTextRevealing = true;
-	TextRevealProgress = 0.0f;
-	RevealedCharCount = 0;
+	if (TextReveal)
+	{
+		TextReveal->CharsPerSecond = TextRevealSpeed;
+		TextReveal->RevealIn(NewText);
+	}
 }
 
-void URoundTimerComponent::UpdateTextReveal(float DeltaTime)
+void URoundTimerComponent::HandleRevealFinished(bool bTypedOut)
 {
-	TextRevealProgress += DeltaTime * TextRevealSpeed;
-
-	int32 NewCharCount = FMath::FloorToInt(TextRevealProgress);
-
-	if (NewCharCount >= TargetText.Len())
+	// Hold the idle text for a while, then cycle to the next one
+	if (CurrentState == ETimerState::Idle)
 	{
-		// Reveal complete
-		bTextRevealing = false;
-		RevealedCharCount = TargetText.Len();
+		ScheduleIdleCycle();
 	}
-	else
+}
+
+void URoundTimerComponent::ScheduleIdleCycle()
+{
+	if (UDiceTimerWheel* Wheel = UDiceTimerWheel::Get(this))
 	{
-		RevealedCharCount = NewCharCount;
+		Wheel->Cancel(IdleCycleHandle);
+		IdleCycleHandle = Wheel->Schedule(this, IdleCycleTime, [this]() { AdvanceIdleCycle(); });
 	}
 }
 
-void URoundTimerComponent::UpdateDisplay()
+void URoundTimerComponent::AdvanceIdleCycle()
 {
-	if (!TimerLabel) return;
+	if (CurrentState != ETimerState::Idle) return;
 
-	FString DisplayText;
-	FColor DisplayColor = NormalColor;
+	IdleCycleIndex = (IdleCycleIndex + 1) % 2;
 
-	switch (CurrentState)
+	FString NewText = (IdleCycleIndex == 0) ? TEXT("WELCOME") : TEXT("Miss Ada");
+	if (NewText != LastIdleText)
 	{
-		case ETimerState::Idle:
-		{
-			DisplayColor = NormalColor;
+		LastIdleText = NewText;
+		StartTextReveal(NewText);
+	}
+}
 
-			FString IdleText = (IdleCycleIndex == 0) ? TEXT("WELCOME") : TEXT("Miss Ada");
-			if (bTextRevealing)
-			{
-				DisplayText = GetRevealedText(IdleText);
-			}
-			else
-			{
-				DisplayText = IdleText;
-			}
-			break;
-		}
+void URoundTimerComponent::UpdateDisplay()
+{
+	if (!TextReveal) return;
 
-		case ETimerState::Hold:
+	switch (CurrentState)
+	{
+		case ETimerState::Countdown:
 		{
-			DisplayColor = NormalColor;
+			SetDisplayColor(TimerColor);
 
-			if (bTextRevealing)
-			{
-				DisplayText = GetRevealedText(TEXT("HOLD"));
-			}
-			else
+			// Only format when the shown hundredths tick over
+			const int32 Centis = FMath::FloorToInt(TimeRemaining * 100.0f);
+			if (Centis != DisplayedCentis)
 			{
-				DisplayText = TEXT("HOLD");
+				DisplayedCentis = Centis;
+				TextReveal->ShowText(*FormatTime(TimeRemaining));
 			}
-			break;
+			return;
 		}
 
-		case ETimerState::Dealing:
-		{
-			DisplayColor = NormalColor;
-
-			if (bTextRevealing)
-			{
-				DisplayText = GetRevealedText(TEXT("DEALING"));
-			}
-			else
-			{
-				DisplayText = TEXT("DEALING");
-			}
-			break;
-		}
+		case ETimerState::TimeUp:
+			SetDisplayColor(TimerColor);
+			DisplayedCentis = INDEX_NONE;
+			TextReveal->ShowText(TEXT("00:00"));
+			return;
 
-		case ETimerState::PlayerReady:
-		{
-			DisplayColor = NormalColor;
+		default:
+			SetDisplayColor(NormalColor);
+			DisplayedCentis = INDEX_NONE;
 
-			if (bTextRevealing)
+			// A running reveal owns the label until it finishes
+			if (!TextReveal->IsRevealing())
 			{
-				DisplayText = GetRevealedText(TEXT("E TO BLITZ"));
+				TextReveal->ShowText(GetStateText());
 			}
-			else
-			{
-				DisplayText = TEXT("E TO BLITZ");
-			}
-			break;
-		}
-
-		case ETimerState::Countdown:
-		{
-			DisplayText = FormatTime(TimeRemaining);
-			DisplayColor = TimerColor;
-			break;
-		}
+			return;
+	}
+}
 
-		case ETimerState::TimeUp:
-		{
-			DisplayText = TEXT("00:00");
-			DisplayColor = TimerColor;
-			break;
-		}
+const TCHAR* URoundTimerComponent::GetStateText() const
+{
+	switch (CurrentState)
+	{
+		case ETimerState::Idle:        return (IdleCycleIndex == 0) ? TEXT("WELCOME") : TEXT("Miss Ada");
+		case ETimerState::Hold:        return TEXT("HOLD");
+		case ETimerState::Dealing:     return TEXT("DEALING");
+		case ETimerState::PlayerReady: return TEXT("E TO BLITZ");
+		case ETimerState::TimeUp:      return TEXT("00:00");
+		default:                       return TEXT("");
 	}
+}
 
-	TimerLabel->SetText(FText::FromString(DisplayText));
-	TimerLabel->SetTextRenderColor(DisplayColor);
+void URoundTimerComponent::SetDisplayColor(const FColor& Color)
+{
+	if (TimerLabel && Color != DisplayedColor)
+	{
+		DisplayedColor = Color;
+		UDiceLabelBatcher::SetColor(TimerLabel, Color);
+	}
 }
 
 FString URoundTimerComponent::FormatTime(float Seconds)
@@ -309,29 +323,3 @@ FString URoundTimerComponent::FormatTime(float Seconds)
 
 	return FString::Printf(TEXT("%02d:%02d"), Secs, Hundredths);
 }
-
-FString URoundTimerComponent::GetRevealedText(const FString& FullText)
-{
-	FString Result;
-
-	// Random characters for the "scramble" effect
-	TArray<TCHAR> ScrambleChars = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9',
-	                                 'A', 'B', 'C', 'D', 'E', 'F', 'X', '#', '@', '%' };
-
-	for (int32 i = 0; i < FullText.Len(); i++)
-	{
-		if (i < RevealedCharCount)
-		{
-			// This character is revealed
-			Result.AppendChar(FullText[i]);
-		}
-		else
-		{
-			// This character is still scrambled - pick random char
-			int32 RandomIndex = FMath::RandRange(0, ScrambleChars.Num() - 1);
-			Result.AppendChar(ScrambleChars[RandomIndex]);
-		}
-	}
-
-	return Result;
-}
@@ -2,9 +2,11 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "DiceTimerWheel.h"
 #include "RoundTimerComponent.generated.h"
 
 class UTextRenderComponent;
+class UDiceTextRevealComponent;
 
 UENUM(BlueprintType)
 enum class ETimerState : uint8
@@ -90,22 +92,28 @@ public:
 
 private:
 	UTextRenderComponent* TimerLabel;
+	UDiceTextRevealComponent* TextReveal;  // Owns the label text - only pushes when the shown characters change
 
 	void UpdateDisplay();
 	FString FormatTime(float Seconds);
+	const TCHAR* GetStateText() const;
+	void SetDisplayColor(const FColor& Color);
+
+	FColor DisplayedColor;
+	int32 DisplayedCentis;  // Countdown value last formatted, INDEX_NONE outside the countdown
+
+	// Rebuild rate for 'stat DiceGame'
+	int32 LastTextPushes;
+	float TextRebuildWindow;
 
 	// Text reveal animation
 	void StartTextReveal(const FString& NewText);
-	void UpdateTextReveal(float DeltaTime);
-	FString GetRevealedText(const FString& FullText);
-
-	bool bTextRevealing;
-	float TextRevealProgress;
-	FString TargetText;
-	int32 RevealedCharCount;
+	void HandleRevealFinished(bool bTypedOut);
 
 	// Idle cycle
-	float IdleCycleTimer;
+	FDiceTimerHandle IdleCycleHandle;
+	void ScheduleIdleCycle();
+	void AdvanceIdleCycle();
 	int32 IdleCycleIndex;  // 0 = WELCOME, 1 = Miss Ada
 	FString LastIdleText;
 };
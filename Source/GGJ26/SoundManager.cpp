@@ -1,10 +1,35 @@
 #include "SoundManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
+#include "Components/AudioComponent.h"
+#include "GGJ26.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarDiceImpactMinVolume(
+	TEXT("dice.Audio.ImpactMinVolume"),
+	0.25f,
+	TEXT("Volume of the softest impact that makes a sound; the hardest plays at full volume."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarDiceImpactPitchRange(
+	TEXT("dice.Audio.ImpactPitchRange"),
+	0.2f,
+	TEXT("Pitch spread across impact strength - soft impacts play this much lower, hard ones this much higher (plus the random variation)."),
+	ECVF_Default);
+
+DECLARE_CYCLE_STAT(TEXT("Sound Impact Flush"), STAT_DiceSoundImpactFlush, STATGROUP_DiceGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sound Voices Stolen"), STAT_DiceSoundVoicesStolen, STATGROUP_DiceGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sound Plays Dropped"), STAT_DiceSoundPlaysDropped, STATGROUP_DiceGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sound Impacts Queued"), STAT_DiceSoundImpactsQueued, STATGROUP_DiceGame);
+
+ASoundManager* ASoundManager::Instance = nullptr;
 
 ASoundManager::ASoundManager()
 {
-	PrimaryActorTick.bCanEverTick = false;
+	// Ticks only while impacts are queued, after physics has reported this frame's hits
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+	PrimaryActorTick.TickGroup = TG_PostPhysics;
 
 	// Sound assets
 	DiceRollSound = nullptr;
@@ -21,66 +46,280 @@ ASoundManager::ASoundManager()
 	// Pitch settings
 	HoverPitch = 1.3f;  // Slightly faster/snappier
 	DiceRollPitchVariation = 0.15f;  // +/- 15% random pitch
+
+	// Voice limits
+	DiceVoices = 3;
+	MatchVoices = 2;
+	KnifeVoices = 1;
+	UIVoices = 2;
+	HoverCooldown = 0.06f;
+	LastHoverTime = -1.0;
+}
+
+void ASoundManager::BeginPlay()
+{
+	Super::BeginPlay();
+	Instance = this;
+
+	CreateVoices(ESoundVoice::Dice, DiceVoices);
+	CreateVoices(ESoundVoice::Match, MatchVoices);
+	CreateVoices(ESoundVoice::Knife, KnifeVoices);
+	CreateVoices(ESoundVoice::UI, UIVoices);
+	PrimeSounds();
+}
+
+void ASoundManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (Instance == this)
+	{
+		Instance = nullptr;
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+ASoundManager* ASoundManager::GetInstance(UWorld* World)
+{
+	if (Instance)
+	{
+		return Instance;
+	}
+
+	if (World)
+	{
+		TArray<AActor*> Found;
+		UGameplayStatics::GetAllActorsOfClass(World, ASoundManager::StaticClass(), Found);
+		if (Found.Num() > 0)
+		{
+			Instance = Cast<ASoundManager>(Found[0]);
+			return Instance;
+		}
+	}
+
+	return nullptr;
+}
+
+void ASoundManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushImpacts();
+	SetActorTickEnabled(false);
+}
+
+void ASoundManager::PrimeSounds()
+{
+	for (USoundBase* Sound : { DiceRollSound, DiceMatchSound, KnifeCutSound, PickUpSound, HoverSound, ErrorSound })
+	{
+		if (Sound)
+		{
+			UGameplayStatics::PrimeSound(Sound);
+		}
+	}
 }
 
 void ASoundManager::PlayDiceRoll()
 {
 	// Random pitch variation for variety
 	float RandomPitch = 1.0f + FMath::RandRange(-DiceRollPitchVariation, DiceRollPitchVariation);
-	PlaySound2D(DiceRollSound, RandomPitch);
+	PlaySound2D(ESoundVoice::Dice, DiceRollSound, RandomPitch);
 }
 
 void ASoundManager::PlayDiceMatch()
 {
-	PlaySound2D(DiceMatchSound);
+	PlaySound2D(ESoundVoice::Match, DiceMatchSound);
 }
 
 void ASoundManager::PlayKnifeCut()
 {
-	PlaySound2D(KnifeCutSound);
+	PlaySound2D(ESoundVoice::Knife, KnifeCutSound);
 }
 
 void ASoundManager::PlayPickUp()
 {
-	PlaySound2D(PickUpSound);
+	PlaySound2D(ESoundVoice::UI, PickUpSound);
 }
 
 void ASoundManager::PlayHover()
 {
-	PlaySound2D(HoverSound, HoverPitch);
+	// Sweeping across several dice shouldn't machine-gun the hover sound
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	if (LastHoverTime >= 0.0 && Now - LastHoverTime < HoverCooldown)
+	{
+		INC_DWORD_STAT(STAT_DiceSoundPlaysDropped);
+		return;
+	}
+	LastHoverTime = Now;
+
+	PlaySound2D(ESoundVoice::UI, HoverSound, HoverPitch);
 }
 
 void ASoundManager::PlayError()
 {
-	PlaySound2D(ErrorSound);
+	PlaySound2D(ESoundVoice::UI, ErrorSound);
 }
 
 void ASoundManager::PlayDiceRollAtLocation(FVector Location)
 {
 	// Random pitch variation for variety
 	float RandomPitch = 1.0f + FMath::RandRange(-DiceRollPitchVariation, DiceRollPitchVariation);
-	PlaySoundAtLocation(DiceRollSound, Location, RandomPitch);
+	PlaySoundAtLocation(ESoundVoice::Dice, DiceRollSound, Location, RandomPitch);
 }
 
 void ASoundManager::PlayDiceMatchAtLocation(FVector Location)
 {
-	PlaySoundAtLocation(DiceMatchSound, Location);
+	PlaySoundAtLocation(ESoundVoice::Match, DiceMatchSound, Location);
 }
 
-void ASoundManager::PlaySound2D(USoundBase* Sound, float Pitch)
+// ==================== IMPACTS ====================
+
+void ASoundManager::QueueDiceImpact(const AActor* Source, FVector Location, float Strength)
 {
-	if (Sound)
+	if (!DiceRollSound)
 	{
-		float FinalVolume = MasterVolume * SFXVolume;
-		UGameplayStatics::PlaySound2D(this, Sound, FinalVolume, Pitch);
+		return;
 	}
+
+	INC_DWORD_STAT(STAT_DiceSoundImpactsQueued);
+
+	// One impact per source per frame - the strongest
+	for (FPendingImpact& Pending : PendingImpacts)
+	{
+		if (Pending.Source == Source)
+		{
+			if (Strength > Pending.Strength)
+			{
+				Pending.Location = Location;
+				Pending.Strength = Strength;
+			}
+			return;
+		}
+	}
+
+	PendingImpacts.Add({ Source, Location, Strength });
+	SetActorTickEnabled(true);
 }
 
-void ASoundManager::PlaySoundAtLocation(USoundBase* Sound, FVector Location, float Pitch)
+void ASoundManager::FlushImpacts()
 {
-	if (Sound)
+	SCOPE_CYCLE_COUNTER(STAT_DiceSoundImpactFlush);
+
+	if (PendingImpacts.Num() == 0)
+	{
+		return;
+	}
+
+	// Loudest first; anything past the dice voice count would only steal a voice started this frame
+	PendingImpacts.Sort([](const FPendingImpact& A, const FPendingImpact& B) { return A.Strength > B.Strength; });
+
+	const int32 NumToPlay = FMath::Min(PendingImpacts.Num(), FMath::Max(1, DiceVoices));
+	const float MinVolume = FMath::Clamp(CVarDiceImpactMinVolume.GetValueOnGameThread(), 0.0f, 1.0f);
+	const float PitchRange = CVarDiceImpactPitchRange.GetValueOnGameThread();
+
+	for (int32 i = 0; i < NumToPlay; i++)
+	{
+		const FPendingImpact& Impact = PendingImpacts[i];
+		const float Volume = FMath::Lerp(MinVolume, 1.0f, Impact.Strength);
+		const float Pitch = 1.0f + (Impact.Strength - 0.5f) * 2.0f * PitchRange
+			+ FMath::RandRange(-DiceRollPitchVariation, DiceRollPitchVariation);
+		PlayVoice(ESoundVoice::Dice, DiceRollSound, FMath::Max(0.1f, Pitch), &Impact.Location, Volume);
+	}
+
+	INC_DWORD_STAT_BY(STAT_DiceSoundPlaysDropped, PendingImpacts.Num() - NumToPlay);
+	PendingImpacts.Reset();
+}
+
+void ASoundManager::PlaySound2D(ESoundVoice Voice, USoundBase* Sound, float Pitch)
+{
+	PlayVoice(Voice, Sound, Pitch, nullptr);
+}
+
+void ASoundManager::PlaySoundAtLocation(ESoundVoice Voice, USoundBase* Sound, FVector Location, float Pitch)
+{
+	PlayVoice(Voice, Sound, Pitch, &Location);
+}
+
+// ==================== VOICES ====================
+
+void ASoundManager::CreateVoices(ESoundVoice Voice, int32 Count)
+{
+	FVoicePool& Pool = Pools[static_cast<int32>(Voice)];
+	for (int32 i = 0; i < Count; i++)
+	{
+		UAudioComponent* Comp = NewObject<UAudioComponent>(this);
+		Comp->bAutoActivate = false;
+		Comp->bAutoDestroy = false;
+		Comp->bIsUISound = false;
+		Comp->SetUsingAbsoluteLocation(true);
+		Comp->RegisterComponent();
+
+		Pool.Voices.Add(Comp);
+		Pool.StartTimes.Add(-1.0);
+		VoiceComponents.Add(Comp);
+	}
+}
+
+UAudioComponent* ASoundManager::AcquireVoice(ESoundVoice Voice)
+{
+	FVoicePool& Pool = Pools[static_cast<int32>(Voice)];
+	if (Pool.Voices.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// A free voice, otherwise steal the one that started longest ago
+	int32 Oldest = 0;
+	for (int32 i = 0; i < Pool.Voices.Num(); i++)
+	{
+		if (!Pool.Voices[i]->IsPlaying())
+		{
+			Oldest = i;
+			break;
+		}
+		if (Pool.StartTimes[i] < Pool.StartTimes[Oldest])
+		{
+			Oldest = i;
+		}
+		if (i == Pool.Voices.Num() - 1)
+		{
+			INC_DWORD_STAT(STAT_DiceSoundVoicesStolen);
+			Pool.Voices[Oldest]->Stop();
+		}
+	}
+
+	Pool.StartTimes[Oldest] = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	return Pool.Voices[Oldest];
+}
+
+void ASoundManager::PlayVoice(ESoundVoice Voice, USoundBase* Sound, float Pitch, const FVector* Location, float VolumeScale)
+{
+	if (!Sound)
+	{
+		return;
+	}
+
+	UAudioComponent* Comp = AcquireVoice(Voice);
+	if (!Comp)
+	{
+		// Pools not built yet (called before BeginPlay) - fire a one-off sound as before
+		float FinalVolume = MasterVolume * SFXVolume * VolumeScale;
+		if (Location)
+		{
+			UGameplayStatics::PlaySoundAtLocation(this, Sound, *Location, FRotator::ZeroRotator, FinalVolume, Pitch);
+		}
+		else
+		{
+			UGameplayStatics::PlaySound2D(this, Sound, FinalVolume, Pitch);
+		}
+		return;
+	}
+
+	Comp->SetSound(Sound);
+	Comp->bAllowSpatialization = (Location != nullptr);
+	if (Location)
 	{
-		float FinalVolume = MasterVolume * SFXVolume;
-		UGameplayStatics::PlaySoundAtLocation(this, Sound, Location, FRotator::ZeroRotator, FinalVolume, Pitch);
+		Comp->SetWorldLocation(*Location);
 	}
+	Comp->SetVolumeMultiplier(MasterVolume * SFXVolume * VolumeScale);
+	Comp->SetPitchMultiplier(Pitch);
+	Comp->Play();
 }
@@ -5,6 +5,17 @@
 #include "SoundManager.generated.h"
 
 class USoundBase;
+class UAudioComponent;
+
+// Voice pools - each has its own preallocated audio components and voice limit
+enum class ESoundVoice : uint8
+{
+	Dice,   // Rolls and landings
+	Match,
+	Knife,
+	UI,     // Pick up, hover, error
+	Count
+};
 
 UCLASS()
 class ASoundManager : public AActor
@@ -14,6 +25,12 @@ class ASoundManager : public AActor
 public:
 	ASoundManager();
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaTime) override;
+
+	static ASoundManager* GetInstance(UWorld* World);
+
 	// Sound assets - drag your SFX here
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sounds")
 	USoundBase* DiceRollSound;
@@ -47,6 +64,23 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", meta = (ClampMin = "0.8", ClampMax = "1.2"))
 	float DiceRollPitchVariation;  // Random pitch variation for dice
 
+	// Voice limits - past these the oldest voice in the pool is stolen
+	UPROPERTY(EditAnywhere, Category = "Voices", meta = (ClampMin = "1"))
+	int32 DiceVoices;
+
+	UPROPERTY(EditAnywhere, Category = "Voices", meta = (ClampMin = "1"))
+	int32 MatchVoices;
+
+	UPROPERTY(EditAnywhere, Category = "Voices", meta = (ClampMin = "1"))
+	int32 KnifeVoices;
+
+	UPROPERTY(EditAnywhere, Category = "Voices", meta = (ClampMin = "1"))
+	int32 UIVoices;
+
+	// Hovers closer together than this are dropped
+	UPROPERTY(EditAnywhere, Category = "Voices", meta = (ClampMin = "0.0"))
+	float HoverCooldown;
+
 	// Play functions
 	UFUNCTION(BlueprintCallable, Category = "Sound")
 	void PlayDiceRoll();
@@ -73,7 +107,43 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Sound")
 	void PlayDiceMatchAtLocation(FVector Location);
 
+	// Queue a physics impact (Strength 0..1) - flushed once per frame after physics,
+	// one per source and only the strongest few, so a pile of dice landing costs a handful of voices
+	void QueueDiceImpact(const AActor* Source, FVector Location, float Strength);
+
+	// Start decoding/streaming every sound so its first play doesn't hitch
+	void PrimeSounds();
+
 private:
-	void PlaySound2D(USoundBase* Sound, float Pitch = 1.0f);
-	void PlaySoundAtLocation(USoundBase* Sound, FVector Location, float Pitch = 1.0f);
+	struct FVoicePool
+	{
+		TArray<UAudioComponent*> Voices;
+		TArray<double> StartTimes;  // Per voice - the oldest is stolen when all are busy
+	};
+	FVoicePool Pools[static_cast<int32>(ESoundVoice::Count)];
+
+	// Keeps the pooled components alive - Pools only points at them
+	UPROPERTY(Transient)
+	TArray<UAudioComponent*> VoiceComponents;
+
+	double LastHoverTime;
+
+	struct FPendingImpact
+	{
+		const AActor* Source;  // Only compared, never dereferenced
+		FVector Location;
+		float Strength;
+	};
+	TArray<FPendingImpact> PendingImpacts;
+
+	static ASoundManager* Instance;
+
+	void FlushImpacts();
+
+	void CreateVoices(ESoundVoice Voice, int32 Count);
+	UAudioComponent* AcquireVoice(ESoundVoice Voice);
+	void PlayVoice(ESoundVoice Voice, USoundBase* Sound, float Pitch, const FVector* Location, float VolumeScale = 1.0f);
+
+	void PlaySound2D(ESoundVoice Voice, USoundBase* Sound, float Pitch = 1.0f);
+	void PlaySoundAtLocation(ESoundVoice Voice, USoundBase* Sound, FVector Location, float Pitch = 1.0f);
 };